@@ -0,0 +1,24 @@
+/* HSV to RGB conversion benchmark, see common/bench/bench.h.
+ *
+ * Sweeps the hue like the rainbow of main.c. Built on the host by the bench target of
+ * common/host/Makefile; on the dongle run_benchmarks() in main.c measures the same loop.
+ */
+#include "bench.h"
+#include "color.h"
+
+static HsvColor          m_hsv = { .h = 0, .s = 100, .v = 100 };
+static RgbColor volatile m_rgb;
+
+static void bench_hsv_to_rgb(void * p_ctx)
+{
+    UNUSED_PARAMETER(p_ctx);
+
+    RgbColor rgb = HsvToRgb(m_hsv);
+
+    m_rgb.r = rgb.r;
+    m_rgb.g = rgb.g;
+    m_rgb.b = rgb.b;
+    m_hsv.h = (m_hsv.h == 359) ? 0 : m_hsv.h + 1;
+}
+
+BENCH_DEF(hsv_to_rgb, bench_hsv_to_rgb, NULL, 8);
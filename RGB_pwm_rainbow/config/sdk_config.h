@@ -46,6 +46,21 @@
 #ifdef USE_APP_CONFIG
 #include "app_config.h"
 #endif
+// <h> Application
+
+//==========================================================
+// <q> BENCH_ENABLED  - Measure HsvToRgb() at boot
+
+// <i> Stores the cycles per call in bench_hsv_to_rgb_cycles for apps/build/profile_bench.py --run.
+// <i> Set by make BENCH=1, off in the normal build.
+
+#ifndef BENCH_ENABLED
+#define BENCH_ENABLED 0
+#endif
+
+// </h>
+//==========================================================
+
 // <h> nRF_Drivers 
 
 //==========================================================
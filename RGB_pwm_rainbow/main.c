@@ -17,17 +17,27 @@
 #include "app_pwm.h"
 
 #include "color.h"
+#include "bench_dwt.h"
 
 // Note: Timers are enabled in config/sdk_config.h
 APP_PWM_INSTANCE(PWM_R, 1);              // Create the instance "PWM_R" using TIMER1.
 APP_PWM_INSTANCE(PWM_G, 2);              // Create the instance "PWM_G" using TIMER2.
 APP_PWM_INSTANCE(PWM_B, 3);              // Create the instance "PWM_B" using TIMER3.
 
+#if BENCH_ENABLED
+/* Cycle counts measured at boot, read from the target by apps/build/profile_bench.py */
+volatile uint32_t bench_hsv_to_rgb_cycles __attribute__((used));   // Average cycles per call
+volatile uint32_t bench_hsv_to_rgb_checksum __attribute__((used)); // Keeps the results alive
+#endif
+
 /* ================ Function Declaration ======================================================== */
 static void init_PWM(app_pwm_t const * const p_PWM, uint32_t pin, uint32_t period);
 static void update_rainbow_effect(uint32_t speed);
 static void set_RGB_PWM(uint32_t R, uint32_t G, uint32_t B);
 static void start_error_mode(void);
+#if BENCH_ENABLED
+static void run_benchmarks(void);
+#endif
 void pwm_ready_callback(uint32_t pwm_id);
 
 /* ================ Function Definition ========================================================= */
@@ -35,6 +45,10 @@ int main(void)
 {
     const uint32_t pwm_period_us = 1000L; // period [us] == 1KHz
 
+#if BENCH_ENABLED
+    run_benchmarks();
+#endif
+
     /* Initialise error LED and and turn it OFF by default */
     nrf_gpio_cfg_output(LED1_G); nrf_gpio_pin_write(LED1_G, 1);
 
@@ -60,6 +74,27 @@ static void start_error_mode(void)
     }
 }
 
+#if BENCH_ENABLED
+/**@brief Measure the hot functions with the CPU cycle counter, once per boot */
+static void run_benchmarks(void)
+{
+    HsvColor hsv = { .h = 0, .s = 100, .v = 100 };
+    uint32_t checksum = 0;
+
+    bench_dwt_enable();
+
+    // Full colorwheel, as update_rainbow_effect() goes through it
+    uint32_t start = DWT->CYCCNT;
+    for (hsv.h = 0; hsv.h < 360; hsv.h++)
+    {
+        RgbColor rgb = HsvToRgb(hsv);
+        checksum += rgb.r + rgb.g + rgb.b;
+    }
+    bench_hsv_to_rgb_cycles = (DWT->CYCCNT - start) / 360;
+    bench_hsv_to_rgb_checksum = checksum;
+}
+#endif
+
 /**@brief Initialize PWM peripheral with 1CH connected to the given pin */
 static void init_PWM(app_pwm_t const * const p_PWM, uint32_t pin, uint32_t period)
 {
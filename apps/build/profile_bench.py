@@ -0,0 +1,148 @@
+"""
+Builds the apps with every build profile of common/armgcc/profile.mk and compares them.
+
+For every app and profile the script reports the flash and RAM usage and the code size of the
+hot functions, read from the map file as by apps/size/size_report.py. With --run the apps are built
+with BENCH=1 (see common/armgcc/profile.mk), which turns on their boot measurements, and each build
+is flashed and let boot. The cycle counts the app measured, every 32-bit global variable whose name
+starts with bench_ (for example bench_hsv_to_rgb_cycles in RGB_pwm_rainbow, or
+bench_cli_init_cycles in cli), are then read from RAM with nrfjprog.
+
+    python profile_bench.py                          size of all apps, all profiles
+    python profile_bench.py --run RGB_pwm_rainbow    size and cycles, dongle attached
+    python profile_bench.py --make mingw32-make --json bench.json cli
+
+Run it from any directory, the apps are found next to the apps directory.
+"""
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+sys.path.insert(0, os.path.join(ROOT, "apps", "size"))
+sys.path.insert(0, os.path.join(ROOT, "apps", "log"))
+
+from size_report import parse_map  # noqa: E402
+from log_decode import Elf  # noqa: E402
+
+PROFILES = ["speed", "size", "lto", "size_lto", "debug"]
+FUNCTIONS = ["HsvToRgb", "nrf_cli_process", "nrf_cli_init", "app_usbd_event_execute",
+             "nrf_log_frontend_dequeue"]
+MEMRD_RE = re.compile(r"^0x[0-9a-fA-F]+:\s+([0-9a-fA-F]{8})")
+
+
+def app_dirs():
+    return sorted(d for d in os.listdir(ROOT)
+                  if os.path.isfile(os.path.join(ROOT, d, "armgcc", "Makefile")))
+
+
+def build_dir(args, app, profile):
+    suffix = "" if profile == "speed" else "_" + profile
+    if args.run:
+        suffix += "_bench"
+    return os.path.join(ROOT, app, "armgcc", "_build" + suffix)
+
+
+def make(args, app, profile, target):
+    cmd = [args.make, "-C", os.path.join(ROOT, app, "armgcc"), "PROFILE=" + profile, target]
+    if args.run:
+        cmd.append("BENCH=1")
+    out = None if args.verbose else open(os.devnull, "w")
+    return subprocess.call(cmd, stdout=out, stderr=subprocess.STDOUT if out else None) == 0
+
+
+def sizes(args, app, profile, functions):
+    """ Flash and RAM totals and flash size of each function, from the map file. """
+    result = {}
+    for region in parse_map(os.path.join(build_dir(args, app, profile), "nrf52840_xxaa.map")):
+        result[region.name] = region.total
+        if region.name != "FLASH":
+            continue
+        for symbol, size in region.symbols.items():
+            name = symbol.split(" (")[0]
+            if name in functions:
+                result[name] = result.get(name, 0) + size
+    return result
+
+
+def cycles(args, app, profile):
+    """ Flashes the build, waits for the boot measurements and reads the bench_ variables. """
+    if not make(args, app, profile, "flash"):
+        raise RuntimeError("{} {}: flashing failed".format(app, profile))
+    time.sleep(args.wait)
+
+    elf = Elf(os.path.join(build_dir(args, app, profile), "nrf52840_xxaa.out"))
+    result = {}
+    for name, address in sorted(elf.symbols.items()):
+        if not name.startswith("bench_"):
+            continue
+        out = subprocess.check_output(["nrfjprog", "-f", "nrf52", "--memrd", hex(address),
+                                       "--n", "4"]).decode()
+        m = MEMRD_RE.match(out.strip())
+        if m:
+            result[name] = int(m.group(1), 16)
+    return result
+
+
+def print_table(results, columns):
+    width = max([len("app/profile")] + [len(k) for k in results])
+    print("{:<{w}}".format("app/profile", w=width) +
+          "".join(" {:>{c}}".format(c, c=max(8, len(c))) for c in columns))
+    for key, values in results.items():
+        print("{:<{w}}".format(key, w=width) +
+              "".join(" {:>{c}}".format(values.get(c, "-"), c=max(8, len(c))) for c in columns))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare the build profiles of the apps.")
+    parser.add_argument("apps", nargs="*", help="app directories (default: all)")
+    parser.add_argument("--profiles", default=",".join(PROFILES),
+                        help="comma separated profiles (default: all)")
+    parser.add_argument("--functions", default=",".join(FUNCTIONS),
+                        help="comma separated functions whose code size is reported")
+    parser.add_argument("--run", action="store_true",
+                        help="build with BENCH=1, flash every build and read the bench_ "
+                             "cycle counts")
+    parser.add_argument("--wait", type=float, default=2.0,
+                        help="seconds between flashing and reading the counts (default: 2)")
+    parser.add_argument("--make", default="make", help="make command (default: make)")
+    parser.add_argument("--json", help="also write the results to this file")
+    parser.add_argument("--verbose", action="store_true", help="show the make output")
+    args = parser.parse_args()
+
+    functions = args.functions.split(",")
+    results = {}
+    for app in args.apps or app_dirs():
+        for profile in args.profiles.split(","):
+            key = "{}/{}".format(app.strip("/\\"), profile)
+            if not make(args, app, profile, "default"):
+                sys.stderr.write("{}: build failed\n".format(key))
+                continue
+            try:
+                results[key] = sizes(args, app, profile, functions)
+            except (IOError, ValueError) as e:
+                sys.stderr.write("{}: {}\n".format(key, e))
+                continue
+            if args.run:
+                results[key].update(cycles(args, app, profile))
+
+    columns = ["FLASH", "RAM"] + [f for f in functions if any(f in r for r in results.values())]
+    columns += sorted(set(c for r in results.values() for c in r if c.startswith("bench_")))
+    print_table(results, columns)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(results, f, indent=1, sort_keys=True)
+            f.write("\n")
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except (IOError, ValueError, RuntimeError, subprocess.CalledProcessError) as e:
+        sys.stderr.write("{}\n".format(e))
+        sys.exit(1)
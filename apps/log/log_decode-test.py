@@ -0,0 +1,167 @@
+"""
+Test of the argument decoding of log_decode.py.
+
+Run on the host:
+    python3 log_decode-test.py
+
+The ELF file is replaced by a table of strings. Frames are built by the rules of
+cli/log_backend_bin.c: varints, one word per argument, and %s arguments pointing to RAM (or NULL)
+inlined as 0, the length as a varint and the characters. string_args_get() is ported below, so the
+decoder is checked against the device's view of the format, not its own.
+"""
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import log_decode  # noqa: E402
+
+fails = 0
+
+RAM_START = 0x20000000
+STRING_LEN_MAX = 255
+
+
+class FakeElf(object):
+
+    def __init__(self, strings):
+        self.strings = strings
+        self.symbols = {}
+
+    def string(self, address):
+        return self.strings.get(address)
+
+    def read(self, address, length):
+        return None
+
+
+class RamString(object):
+    """ %s argument pointing to RAM, the device sends its characters. """
+
+    def __init__(self, text):
+        self.text = text
+
+
+def check(cond, what):
+    global fails
+    if not cond:
+        print("FAIL: " + what)
+        fails += 1
+
+
+def varint(value):
+    out = bytearray()
+    value &= 0xFFFFFFFF
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def word(value):
+    """ Argument word of a signed value, as the device stores it. """
+    return value & 0xFFFFFFFF
+
+
+def string_args_get(fmt):
+    """ Port of string_args_get() of cli/log_backend_bin.c. """
+    mask = 0
+    arg = 0
+    i = 0
+    while i < len(fmt):
+        c = fmt[i]
+        i += 1
+        if c != "%":
+            continue
+        if i < len(fmt) and fmt[i] == "%":
+            i += 1
+            continue
+        while i < len(fmt) and fmt[i] in "-+ #0123456789.*hlzjtL":
+            if fmt[i] == "*":
+                arg += 1
+            i += 1
+        if i == len(fmt):
+            break
+        if fmt[i] == "s":
+            mask |= 1 << arg
+        i += 1
+        arg += 1
+    return mask
+
+
+def device_frame(fmt_addr, fmt, args, severity=3, timestamp=1000):
+    """ Standard entry as log_backend_bin_encode() builds it. """
+    strings = string_args_get(fmt)
+    out = bytearray([severity | log_decode.FLAG_ABS_TIME])
+    out += varint(0) + varint(timestamp) + varint((fmt_addr << 3) | len(args))
+    for i, arg in enumerate(args):
+        inline = isinstance(arg, RamString) or arg is None
+        address = RAM_START if isinstance(arg, RamString) else (arg or 0)
+        if (strings & (1 << i)) and (address >= RAM_START or address == 0):
+            data = arg.text.encode()[:STRING_LEN_MAX] if inline and arg is not None else b""
+            out += varint(0) + varint(len(data)) + data
+        else:
+            out += varint(address)
+    return bytes(out)
+
+
+def decode(decoder, fmt_addr, args):
+    text = decoder.frame(device_frame(fmt_addr, decoder.elf.string(fmt_addr), args))
+    print(text.rstrip())
+    return text
+
+
+def main():
+    long_text = "x" * 200
+    elf = FakeElf({
+        0x100: "-",
+        0x104: "",
+        0x200: "%s%d.%02d",
+        0x300: "%s %d %s",
+        0x400: "%*d|%s",
+        0x500: "%f %s %u",
+        0x600: "%s",
+        0x700: "100%% %s",
+    })
+    decoder = log_decode.Decoder(elf, 1000000, 32)
+
+    # The port agrees with the device on the string arguments.
+    check(string_args_get("%s%d.%02d") == 0x1, "marker strings")
+    check(string_args_get("%*d|%s") == 0x4, "star width takes a word")
+    check(string_args_get("%f %s %u") == 0x2, "float takes one word")
+    check(string_args_get("100%% %s") == 0x1, "escaped percent")
+
+    # NRF_LOG_FLOAT_MARKER, the sign as a string in flash.
+    text = decode(decoder, 0x200, [0x100, 0, 50])
+    check(text == "[00:00:00.001,000] <info> 0: -0.50\n", "marker, negative")
+    check(decode(decoder, 0x200, [0x104, 12, 3]).endswith(" 12.03\n"), "marker, positive")
+
+    # Strings in flash and in RAM.
+    text = decode(decoder, 0x300, [0x100, word(-7), RamString("ram")])
+    check(text.endswith(" - -7 ram\n"), "flash and RAM strings")
+    check(decode(decoder, 0x600, [None]).endswith(" \n"), "NULL string")
+
+    # A string longer than 127 characters has a two byte length.
+    check(decode(decoder, 0x600, [RamString(long_text)]).endswith(" " + long_text + "\n"),
+          "long inlined string")
+    check(decode(decoder, 0x600, [RamString("y" * 300)]).endswith(" " + "y" * 255 + "\n"),
+          "string truncated to 255 characters")
+
+    # '*' consumes a word before the value.
+    check(decode(decoder, 0x400, [5, 42, RamString("s")]).endswith("    42|s\n"), "star width")
+
+    # %f takes one word, the following string and word stay in place.
+    text = decode(decoder, 0x500, [word(-3), RamString("ram"), 9])
+    check(text.endswith(" -3.000000 ram 9\n"), "float is one word")
+
+    check(decode(decoder, 0x700, [RamString("ok")]).endswith(" 100% ok\n"), "escaped percent")
+
+    print("FAILED" if fails else "PASSED")
+    return 1 if fails else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,311 @@
+"""
+Decoder for the binary logger backend (cli/log_backend_bin.c).
+
+The device sends format string addresses and raw arguments, the strings are read from the
+ELF file of the running image. Capture RTT channel 1 to a file, for example with
+    JLinkRTTLogger -Device NRF52840_XXAA -If SWD -Speed 4000 -RTTChannel 1 binlog.bin
+and decode it with
+    python log_decode.py _build/nrf52840_xxaa.out binlog.bin
+Without the input file the stream is read from stdin, so the logger output can be piped in.
+
+Logs kept in flash by cli/log_backend_store.c are read with the `logstore dump` CLI command,
+which prints one hex line per stored block, and the last entries before a crash with
+`crashlog show` (cli/crash_log.c). Save the output and decode it with --hex:
+    python log_decode.py --hex _build/nrf52840_xxaa.out logstore.txt
+"""
+import argparse
+import re
+import struct
+import sys
+
+SEVERITY = {1: "error", 2: "warning", 3: "info", 4: "debug"}
+SEVERITY_INFO_RAW = 5
+
+FLAG_HEXDUMP = 0x08
+FLAG_ABS_TIME = 0x10
+FLAG_DROPPED = 0x20
+FRAME_SESSION = 0xC0
+
+MARKER = b"nrf_log binary v1"
+
+# Size of nrf_log_module_const_data_t with -fshort-enums: name pointer, two colors, two levels.
+MODULE_ENTRY_SIZE = 8
+
+HEX_RE = re.compile(r"^[0-9a-fA-F]+$")
+FMT_RE = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|z|j|t|L)?([diouxXcspfeEgG%])")
+
+
+class Elf(object):
+    """ Minimal 32-bit little endian ELF reader, enough to read strings and symbols. """
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("{} is not a 32-bit ELF file".format(path))
+
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            self.sections.append(struct.unpack_from("<IIIIIIIIII", self.data, shoff + i * shentsize))
+
+        self.symbols = {}
+        for sh in self.sections:
+            if sh[1] == 2:  # SHT_SYMTAB
+                strtab = self.sections[sh[6]]
+                for off in range(sh[4], sh[4] + sh[5], 16):
+                    name, value = struct.unpack_from("<II", self.data, off)
+                    self.symbols[self._cstr(strtab[4] + name)] = value
+
+    def _cstr(self, offset):
+        end = self.data.index(b"\0", offset)
+        return self.data[offset:end].decode("utf-8", "replace")
+
+    def read(self, address, length):
+        for sh in self.sections:
+            sh_type, flags, addr, offset, size = sh[1], sh[2], sh[3], sh[4], sh[5]
+            # Allocated sections with file contents (no .bss).
+            if (flags & 0x2) and sh_type != 8 and addr <= address < addr + size:
+                start = offset + address - addr
+                return self.data[start:start + min(length, addr + size - address)]
+        return None
+
+    def string(self, address):
+        for sh in self.sections:
+            sh_type, flags, addr, offset, size = sh[1], sh[2], sh[3], sh[4], sh[5]
+            if (flags & 0x2) and sh_type != 8 and addr <= address < addr + size:
+                return self._cstr(offset + address - addr)
+        return None
+
+
+def varint(frame, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = frame[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def cobs_frames(stream):
+    buf = bytearray()
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            return
+        for byte in bytearray(chunk):
+            if byte != 0:
+                buf.append(byte)
+                continue
+            out = bytearray()
+            i = 0
+            while i < len(buf):
+                code = buf[i]
+                out += buf[i + 1:i + code]
+                i += code
+                if code != 0xFF and i < len(buf):
+                    out.append(0)
+            buf = bytearray()
+            if out:
+                yield bytes(out)
+
+
+def signed(word):
+    return struct.unpack("<i", struct.pack("<I", word & 0xFFFFFFFF))[0]
+
+
+def c_format(elf, fmt, args):
+    """ Formats like the device printf would, args are the raw 32-bit words. """
+    out = []
+    pos = 0
+    args = list(args)
+    for m in FMT_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, precision, _, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        if width == "*":
+            width = str(args.pop(0)) if args else ""
+        if precision == "*":
+            precision = str(args.pop(0)) if args else ""
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        if not args:
+            out.append(m.group(0))
+            continue
+        arg = args.pop(0)
+        if conv == "s":
+            if isinstance(arg, str):
+                value = arg
+            else:
+                value = elf.string(arg) if arg else "(null)"
+                if value is None:
+                    value = "<0x{:08x}>".format(arg)
+            out.append((spec + "s") % value)
+        elif conv in "di":
+            out.append((spec + "d") % signed(arg))
+        elif conv == "c":
+            out.append((spec + "c") % chr(arg & 0xFF))
+        elif conv == "p":
+            out.append("0x%08x" % arg)
+        elif conv in "feEgG":
+            # nrf_log casts every argument to one 32-bit word, a float arrives truncated to an
+            # integer. Floats are logged with NRF_LOG_FLOAT_MARKER, which has no %f.
+            out.append((spec + conv) % signed(arg))
+        else:
+            out.append((spec + conv) % arg)
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def hex_frames(stream):
+    """ Frames of the blocks dumped by `logstore dump`: varint length, then the frame. """
+    for line in stream:
+        line = line.decode("ascii", "replace").strip()
+        if not line or len(line) % 2 or not HEX_RE.match(line):
+            continue
+        block = bytearray.fromhex(line)
+        pos = 0
+        while pos < len(block):
+            length, pos = varint(block, pos)
+            yield bytes(block[pos:pos + length])
+            pos += length
+
+
+class Decoder(object):
+
+    def __init__(self, elf, timestamp_freq, timestamp_bits):
+        self.elf = elf
+        self.freq = timestamp_freq
+        self.mask = (1 << timestamp_bits) - 1
+        self.timestamp = 0
+        self.modules = {}
+        start = elf.symbols.get("__start_log_const_data")
+        stop = elf.symbols.get("__stop_log_const_data")
+        if start is not None and stop is not None:
+            for idx, addr in enumerate(range(start, stop, MODULE_ENTRY_SIZE)):
+                raw = elf.read(addr, 4)
+                if raw is not None:
+                    self.modules[idx] = elf.string(struct.unpack("<I", raw)[0])
+
+    def prefix(self, severity, module_id):
+        ticks = self.timestamp
+        seconds = ticks // self.freq
+        us = (ticks % self.freq) * 1000000 // self.freq
+        return "[{:02d}:{:02d}:{:02d}.{:03d},{:03d}] <{}> {}: ".format(
+            seconds // 3600, (seconds // 60) % 60, seconds % 60, us // 1000, us % 1000,
+            SEVERITY.get(severity, "?"), self.modules.get(module_id, module_id))
+
+    def session(self, frame):
+        addr, _ = varint(frame, 1)
+        if self.elf.read(addr, len(MARKER)) != MARKER:
+            sys.stderr.write("warning: ELF file does not match the running image\n")
+        self.timestamp = 0
+        return None
+
+    def frame(self, frame):
+        flags = frame[0]
+        if flags == FRAME_SESSION:
+            return self.session(frame)
+
+        severity = flags & 0x07
+        module_id, pos = varint(frame, 1)
+        ts, pos = varint(frame, pos)
+        if flags & FLAG_ABS_TIME:
+            self.timestamp = ts
+        else:
+            self.timestamp = (self.timestamp + ts) & self.mask
+        lines = []
+        if flags & FLAG_DROPPED:
+            dropped, pos = varint(frame, pos)
+            lines.append("Logs dropped ({})\n".format(dropped))
+
+        if flags & FLAG_HEXDUMP:
+            length, pos = varint(frame, pos)
+            data = bytearray(frame[pos:pos + length])
+            text = self.prefix(severity, module_id) + "\n"
+            for i in range(0, len(data), 8):
+                chunk = data[i:i + 8]
+                text += " " + " ".join("{:02X}".format(b) for b in chunk) + \
+                        "   " * (8 - len(chunk)) + "|" + \
+                        "".join(chr(b) if 32 <= b < 127 else "." for b in chunk) + "\n"
+            lines.append(text)
+            return "".join(lines)
+
+        word, pos = varint(frame, pos)
+        fmt_addr, nargs = word >> 3, word & 0x07
+        fmt = self.elf.string(fmt_addr)
+        if fmt is None:
+            lines.append("<unknown format string 0x{:08x}>\n".format(fmt_addr))
+            return "".join(lines)
+
+        text = c_format(self.elf, fmt, parse_std_args(fmt, frame, pos, nargs))
+        if severity == SEVERITY_INFO_RAW:
+            lines.append(text)
+        else:
+            lines.append(self.prefix(severity, module_id) + text.rstrip("\r\n") + "\n")
+        return "".join(lines)
+
+
+def parse_std_args(fmt, frame, pos, nargs):
+    """ Parses the arguments of a standard entry, using the format to find inlined strings.
+
+    Every conversion takes one word and every '*' one more, as string_args_get() counts them. An
+    inlined string is a 0 word, its length as a varint and the characters.
+    """
+    string_args = set()
+    idx = 0
+    for m in FMT_RE.finditer(fmt):
+        _, width, precision, _, conv = m.groups()
+        if conv == "%":
+            continue
+        idx += (width == "*") + (precision == "*")
+        if conv == "s":
+            string_args.add(idx)
+        idx += 1
+
+    args = []
+    for i in range(nargs):
+        arg, pos = varint(frame, pos)
+        if i in string_args and arg == 0:
+            length, pos = varint(frame, pos)
+            arg = frame[pos:pos + length].decode("utf-8", "replace")
+            pos += length
+        args.append(arg)
+    return args
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode binary nrf_log output.")
+    parser.add_argument("elf", help="ELF file of the running image")
+    parser.add_argument("input", nargs="?", help="captured RTT channel, stdin if omitted")
+    parser.add_argument("--hex", action="store_true",
+                        help="input is the output of the logstore dump CLI command")
+    parser.add_argument("--timestamp-freq", type=int, default=1000000,
+                        help="timestamp frequency in Hz (default: 1000000, timestamp_log_get)")
+    parser.add_argument("--timestamp-bits", type=int, default=32,
+                        help="timestamp counter width (default: 32)")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    decoder = Decoder(elf, args.timestamp_freq, args.timestamp_bits)
+    stream = open(args.input, "rb") if args.input else getattr(sys.stdin, "buffer", sys.stdin)
+
+    frames = hex_frames(stream) if args.hex else cobs_frames(stream)
+    for frame in frames:
+        try:
+            text = decoder.frame(frame)
+        except (IndexError, ValueError, TypeError) as e:
+            text = "<bad frame: {}>\n".format(e)
+        if text:
+            sys.stdout.write(text)
+            sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
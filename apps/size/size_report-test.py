@@ -0,0 +1,73 @@
+"""
+Test of the map file parser of size_report.py.
+
+Run on the host:
+    python3 size_report-test.py
+
+size_report-test.map is a cut down GNU ld map of an app, with the cases the parser has to handle:
+section names too long for their line, a library archive member, fill, zero sized and discarded
+sections, initialized data with a load address in FLASH, and a region other than FLASH and RAM.
+"""
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, HERE)
+import size_report  # noqa: E402
+
+fails = 0
+
+
+def check(cond, what):
+    global fails
+    if not cond:
+        print("FAIL: " + what)
+        fails += 1
+
+
+def main():
+    regions = dict((r.name, r) for r in size_report.parse_map(
+        os.path.join(HERE, "size_report-test.map")))
+
+    check(sorted(regions) == ["FLASH", "RAM"], "FLASH and RAM regions only")
+    flash = regions["FLASH"]
+    ram = regions["RAM"]
+    check((flash.origin, flash.length) == (0x1000, 0xD7000), "FLASH origin and length")
+    check((ram.origin, ram.length) == (0x20000008, 0x3F2F8), "RAM origin and length")
+
+    for region in (flash, ram):
+        print("{}: {} bytes".format(region.name, region.total))
+        for name in sorted(region.modules):
+            print("  {:<24} {}".format(name, region.modules[name]))
+
+    # Code, the long name joined with its numbers, the archive member, fill, log_const_data and
+    # the load image of .data.
+    check(flash.total == 0x40 + 0x24 + 0x14 + 0x8 + 0x8 + 0x10, "FLASH total")
+    check(flash.modules == {"main.c": 0x40 + 0x8 + 0x10, "led.c": 0x24, "libc_nano.a": 0x14,
+                            "(fill)": 0x8}, "FLASH modules")
+    check(flash.symbols.get("led_toggle_long_name (led.c)") == 0x24, "long section name")
+    check(flash.symbols.get("memcpy (lib_a-memcpy.o)") == 0x14, "archive member symbol")
+    check(flash.symbols.get(".log_const_data_app (main.c)") == 0x8, "section without a prefix")
+    check(flash.symbols.get("m_state (main.c)") == 0x10, "initialized data in FLASH")
+    check("empty (main.c)" not in flash.symbols, "zero sized section skipped")
+    check("unused_fn (led.c)" not in flash.symbols, "discarded section skipped")
+
+    # .noinit is in its own region, it is counted in neither.
+    check(ram.total == 0x10 + 0x20 + 0x200 + 0x800, "RAM total")
+    check(ram.modules == {"main.c": 0x10, "led.c": 0x20, "(heap)": 0x200, "(stack)": 0x800},
+          "RAM modules")
+    check(ram.symbols.get("m_state (main.c)") == 0x10, "initialized data in RAM")
+    check(ram.symbols.get("m_buf (led.c)") == 0x20, "bss symbol")
+
+    try:
+        size_report.parse_map(os.path.abspath(__file__))
+        check(False, "not a map file rejected")
+    except ValueError:
+        pass
+
+    print("FAILED" if fails else "PASSED")
+    return 1 if fails else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
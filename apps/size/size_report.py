@@ -0,0 +1,207 @@
+"""
+RAM and flash usage per module and per symbol, read from the GNU ld map file of an app.
+
+Every app Makefile has two targets running this script on _build/nrf52840_xxaa.map:
+    make size_report      print the usage and the deltas against armgcc/size_baseline.json
+    make size_baseline    build and store the current usage as the new baseline
+Each build profile (common/armgcc/profile.mk) has its own baseline, size_baseline_<profile>.json
+for the profiles other than the default one.
+Change sdk_config.h, run `make size_report` and the modules and symbols that grew or shrank are
+listed with their deltas.
+
+The map lists every input section kept by the linker with its address, size and object file.
+Sections are assigned to the FLASH and RAM regions of the Memory Configuration table by address,
+initialized data is counted in both. A module is a source object, or a library archive as a
+whole. A symbol is the function or variable of the section, the SDK is built with
+-ffunction-sections -fdata-sections so there is one per section.
+"""
+import argparse
+import json
+import os
+import re
+import sys
+
+HEX = r"0x[0-9a-fA-F]+"
+REGION_RE = re.compile(r"^(\S+)\s+({0})\s+({0})".format(HEX))
+OUTPUT_RE = re.compile(r"^(\S+)\s+({0})\s+({0})(?:\s+load address\s+({0}))?\s*$".format(HEX))
+INPUT_RE = re.compile(r"^ (\S+)\s+({0})\s+({0})(?:\s+(.+?))?\s*$".format(HEX))
+ADDR_RE = re.compile(r"^\s+({0})\s+({0})(?:\s+load address\s+({0}))?(?:\s+(.+?))?\s*$".format(HEX))
+NAME_RE = re.compile(r"^( ?)([^\s*]\S*|\*fill\*)\s*$")
+
+SYMBOL_PREFIXES = (".text.", ".rodata.", ".data.", ".bss.", ".noinit.")
+PSEUDO_MODULES = {".heap": "(heap)", ".stack": "(stack)", "*fill*": "(fill)"}
+
+
+class Region(object):
+    """ Memory region with the bytes used per module and per symbol. """
+
+    def __init__(self, name, origin, length):
+        self.name = name
+        self.origin = origin
+        self.length = length
+        self.total = 0
+        self.modules = {}
+        self.symbols = {}
+
+    def contains(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+    def add(self, module, symbol, size):
+        self.total += size
+        self.modules[module] = self.modules.get(module, 0) + size
+        self.symbols[symbol] = self.symbols.get(symbol, 0) + size
+
+    def to_dict(self):
+        return {"total": self.total, "length": self.length,
+                "modules": self.modules, "symbols": self.symbols}
+
+
+def module_name(path):
+    """ main.c for _build/nrf52840_xxaa/main.c.o, libc_nano.a for a member of the archive. """
+    path = path.strip()
+    archive = re.match(r"^(.*\.a)\((.*)\)$", path)
+    if archive:
+        return os.path.basename(archive.group(1)), archive.group(2)
+    name = os.path.basename(path)
+    if name.endswith(".o"):
+        name = name[:-2]
+    return name, None
+
+
+def symbol_name(section, module, member):
+    for prefix in SYMBOL_PREFIXES:
+        if section.startswith(prefix):
+            return "{} ({})".format(section[len(prefix):], member or module)
+    return "{} ({})".format(section, member or module)
+
+
+def parse_map(path):
+    """ Returns the FLASH and RAM regions filled from the map file. """
+    with open(path) as f:
+        lines = f.read().splitlines()
+
+    regions = []
+    i = 0
+    while i < len(lines) and not lines[i].startswith("Memory Configuration"):
+        i += 1
+    while i < len(lines) and not lines[i].startswith("Linker script and memory map"):
+        m = REGION_RE.match(lines[i])
+        if m and m.group(1) in ("FLASH", "RAM"):
+            regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+        i += 1
+    if not regions:
+        raise ValueError("{}: no FLASH or RAM region, not a GNU ld map file".format(path))
+
+    def region_of(addr):
+        for region in regions:
+            if region.contains(addr):
+                return region
+        return None
+
+    load_region = None
+    while i < len(lines):
+        line = lines[i]
+        i += 1
+
+        # Long section names are alone on their line, the numbers are on the next one.
+        name = NAME_RE.match(line)
+        if name and i < len(lines) and ADDR_RE.match(lines[i]):
+            line = name.group(1) + name.group(2) + lines[i]
+            i += 1
+
+        m = OUTPUT_RE.match(line)
+        if m:
+            vma = region_of(int(m.group(2), 16))
+            lma = region_of(int(m.group(4), 16)) if m.group(4) else None
+            load_region = lma if lma is not vma else None
+            continue
+
+        m = INPUT_RE.match(line)
+        if not m or m.group(1).startswith("*(") or m.group(1) == "/DISCARD/":
+            continue
+        section, addr, size = m.group(1), int(m.group(2), 16), int(m.group(3), 16)
+        region = region_of(addr)
+        if size == 0 or region is None:
+            continue
+
+        module, member = module_name(m.group(4) or "")
+        symbol = symbol_name(section, module, member)
+        for prefix, pseudo in PSEUDO_MODULES.items():
+            if section.startswith(prefix):
+                module = symbol = pseudo
+        region.add(module, symbol, size)
+        if load_region is not None:
+            load_region.add(module, symbol, size)
+
+    return regions
+
+
+def delta(value, base):
+    if base is None:
+        return ""
+    return "{:+d}".format(value - base) if value != base else "0"
+
+
+def print_table(title, items, baseline, limit):
+    """ Prints the largest items, then the items that changed but did not make the cut. """
+    items = dict(items)
+    for name in baseline or {}:
+        items.setdefault(name, 0)
+    names = sorted(items, key=lambda n: (-items[n], n))
+    shown = [n for n in names[:limit] if items[n]] if limit else [n for n in names if items[n]]
+    if baseline is not None:
+        changed = [n for n in names if n not in shown and items[n] != baseline.get(n, 0)]
+        shown += sorted(changed, key=lambda n: -abs(items[n] - baseline.get(n, 0)))
+
+    width = max([len(title)] + [len(n) for n in shown])
+    print("{:<{w}} {:>8} {:>8}".format(title, "bytes", "delta" if baseline is not None else "",
+                                       w=width))
+    for name in shown:
+        base = baseline.get(name, 0) if baseline is not None else None
+        print("{:<{w}} {:>8} {:>8}".format(name, items[name], delta(items[name], base), w=width))
+    print("")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the RAM and flash usage of an app.")
+    parser.add_argument("map", help="map file written by the linker")
+    parser.add_argument("--baseline", help="print the deltas against this baseline")
+    parser.add_argument("--save-baseline", metavar="FILE", help="store the usage in FILE")
+    parser.add_argument("--symbols", type=int, default=20,
+                        help="number of largest symbols listed per region, 0 for all "
+                             "(default: 20)")
+    args = parser.parse_args()
+
+    regions = parse_map(args.map)
+
+    if args.save_baseline:
+        with open(args.save_baseline, "w") as f:
+            json.dump(dict((r.name, r.to_dict()) for r in regions), f, indent=1, sort_keys=True)
+            f.write("\n")
+        print("Baseline saved to {}".format(args.save_baseline))
+
+    baseline = {}
+    if args.baseline:
+        if os.path.exists(args.baseline):
+            with open(args.baseline) as f:
+                baseline = json.load(f)
+        else:
+            print("No baseline {}, run `make size_baseline` to create it.\n".format(args.baseline))
+
+    for region in regions:
+        base = baseline.get(region.name)
+        print("{}: {} of {} bytes ({:.1f}%){}\n".format(
+            region.name, region.total, region.length, 100.0 * region.total / region.length,
+            ", {} bytes against the baseline".format(delta(region.total, base["total"]))
+            if base else ""))
+        print_table(region.name + " module", region.modules, base and base["modules"], 0)
+        print_table(region.name + " symbol", region.symbols, base and base["symbols"],
+                    args.symbols)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except (IOError, ValueError) as e:
+        sys.stderr.write("{}\n".format(e))
+        sys.exit(1)
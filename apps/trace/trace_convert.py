@@ -0,0 +1,203 @@
+"""
+Converter of the FreeRTOS scheduling trace of blinky_freertos (trace_rec.c) to a Chrome trace.
+
+The recorder is the trace_rec variable of the app, a ring buffer of 8-byte events in RAM. The
+script halts the CPU, reads the variable with nrfjprog at the address found in the ELF file of
+the running image, lets the CPU run again and writes a Chrome trace JSON file:
+    python trace_convert.py _build/nrf52840_xxaa.out trace.json
+Open it with https://ui.perfetto.dev or chrome://tracing. Every task and every instrumented
+interrupt handler is a thread of the timeline: slices for the time they ran, instant events for
+the queue operations and notifications. Queues are named after the symbol at their address,
+their StaticQueue_t buffer.
+
+A dump of the variable saved before, for example with
+    nrfjprog --readram ram.bin
+and cut to the variable, or taken from a debugger, is converted with --dump:
+    python trace_convert.py --dump trace_rec.bin _build/nrf52840_xxaa.out trace.json
+"""
+import argparse
+import json
+import os
+import re
+import struct
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "log"))
+
+from log_decode import Elf  # noqa: E402
+
+MAGIC = 0x43455254
+HEADER = struct.Struct("<IIHBBI")
+EVENT = struct.Struct("<IBBH")
+RAM_BASE = 0x20000000
+
+TASK_IN, TASK_OUT, ISR_ENTER, ISR_EXIT = 1, 2, 3, 4
+QUEUE_SEND, QUEUE_RECEIVE, BLOCK_SEND, BLOCK_RECEIVE, NOTIFY = 5, 6, 7, 8, 9
+FROM_ISR = 0x80
+
+QUEUE_OPS = {QUEUE_SEND: "send", QUEUE_RECEIVE: "receive",
+             BLOCK_SEND: "block send", BLOCK_RECEIVE: "block receive"}
+
+# Exception numbers of the nRF52840, the interrupts are 16 and up.
+EXCEPTIONS = {11: "SVCall", 14: "PendSV", 15: "SysTick"}
+IRQS = ["POWER_CLOCK", "RADIO", "UARTE0", "SPIM0_TWIM0", "SPIM1_TWIM1", "NFCT", "GPIOTE",
+        "SAADC", "TIMER0", "TIMER1", "TIMER2", "RTC0", "TEMP", "RNG", "ECB", "CCM_AAR", "WDT",
+        "RTC1", "QDEC", "COMP", "SWI0_EGU0", "SWI1_EGU1", "SWI2_EGU2", "SWI3_EGU3", "SWI4_EGU4",
+        "SWI5_EGU5", "TIMER3", "TIMER4", "PWM0", "PDM", "", "", "MWU", "PWM1", "PWM2", "SPIM2",
+        "RTC2", "I2S", "FPU", "USBD", "UARTE1", "QSPI", "CRYPTOCELL", "", "", "PWM3", "", "SPIM3"]
+
+ISR_TID = 1000
+MEMRD_RE = re.compile(r"^0x[0-9a-fA-F]+:\s+([0-9a-fA-F\s]+?)(?:\|.*)?$")
+
+
+def memrd(address, length):
+    out = subprocess.check_output(["nrfjprog", "-f", "nrf52", "--memrd", hex(address),
+                                   "--n", str(length)]).decode()
+    data = b""
+    for line in out.splitlines():
+        m = MEMRD_RE.match(line.strip())
+        if m:
+            for word in m.group(1).split():
+                data += struct.pack("<I", int(word, 16))
+    return data[:length]
+
+
+def ring_offset(tasks, name_len):
+    """ Offset of the ring, the names are padded to the alignment of its uint32_t. """
+    return (HEADER.size + tasks * name_len + 3) & ~3
+
+
+def read_target(address):
+    """ Reads the recorder with the CPU halted, so that the ring is not written meanwhile. """
+    subprocess.check_call(["nrfjprog", "-f", "nrf52", "--halt"])
+    try:
+        header = memrd(address, HEADER.size)
+        _, _, events, tasks, name_len, _ = HEADER.unpack(header)
+        return memrd(address, ring_offset(tasks, name_len) + events * EVENT.size)
+    finally:
+        subprocess.check_call(["nrfjprog", "-f", "nrf52", "--run"])
+
+
+def parse(data):
+    """ Returns the timestamp frequency, the task names and the events, oldest first. """
+    magic, freq, size, tasks, name_len, count = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("no trace recorder at this address, magic {:#x}".format(magic))
+
+    names = {}
+    offset = HEADER.size
+    for number in range(1, tasks + 1):
+        name = data[offset:offset + name_len].split(b"\0")[0].decode("utf-8", "replace")
+        if name:
+            names[number] = name
+        offset += name_len
+
+    offset = ring_offset(tasks, name_len)
+    ring = [EVENT.unpack_from(data, offset + i * EVENT.size) for i in range(size)]
+    if count <= size:
+        events = ring[:count]
+    else:
+        start = count % size
+        events = ring[start:] + ring[:start]
+    return freq, names, events, max(0, count - size)
+
+
+def isr_name(exception):
+    if exception >= 16 and exception - 16 < len(IRQS) and IRQS[exception - 16]:
+        return IRQS[exception - 16]
+    return EXCEPTIONS.get(exception, "exception {}".format(exception))
+
+
+def convert(elf, freq, names, events):
+    symbols = dict((address, name) for name, address in elf.symbols.items()
+                   if name and not name.startswith("$"))
+    trace = []
+    threads = {}
+    started = {}
+
+    def thread(tid, name):
+        if tid not in threads:
+            threads[tid] = name
+            trace.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": tid,
+                          "args": {"name": name}})
+            trace.append({"ph": "M", "name": "thread_sort_index", "pid": 0, "tid": tid,
+                          "args": {"sort_index": tid}})
+        return tid
+
+    def task(number):
+        return thread(number, names.get(number, "task {}".format(number)))
+
+    # Timestamps wrap with the 32-bit counter, events are in order.
+    time = 0
+    last = events[0][0] if events else 0
+    for stamp, type_, ident, arg in events:
+        time += (stamp - last) & 0xFFFFFFFF
+        last = stamp
+        ts = time * 1e6 / freq
+
+        if type_ & FROM_ISR:
+            tid = thread(ISR_TID + ident, isr_name(ident))
+        else:
+            tid = task(ident)
+        kind = type_ & ~FROM_ISR
+
+        if kind in (TASK_IN, ISR_ENTER):
+            started[tid] = ts
+        elif kind in (TASK_OUT, ISR_EXIT):
+            # The first slice of a thread may have started before the oldest event kept.
+            begin = started.pop(tid, 0.0)
+            trace.append({"ph": "X", "name": threads[tid], "pid": 0, "tid": tid,
+                          "ts": begin, "dur": ts - begin})
+        elif kind in QUEUE_OPS:
+            address = RAM_BASE + arg * 4
+            queue = symbols.get(address, "{:#010x}".format(address))
+            trace.append({"ph": "i", "s": "t", "name": "{} {}".format(QUEUE_OPS[kind], queue),
+                          "pid": 0, "tid": tid, "ts": ts, "args": {"queue": queue}})
+        elif kind == NOTIFY:
+            target = names.get(arg, "task {}".format(arg))
+            trace.append({"ph": "i", "s": "t", "name": "notify " + target, "pid": 0, "tid": tid,
+                          "ts": ts, "args": {"task": target}})
+
+    # Slices still running at the end of the trace.
+    for tid, begin in started.items():
+        trace.append({"ph": "X", "name": threads[tid], "pid": 0, "tid": tid,
+                      "ts": begin, "dur": time * 1e6 / freq - begin})
+
+    trace.insert(0, {"ph": "M", "name": "process_name", "pid": 0, "args": {"name": "nrf52840"}})
+    return {"traceEvents": trace, "displayTimeUnit": "ns"}, time * 1e6 / freq
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert the trace_rec ring to a Chrome trace.")
+    parser.add_argument("elf", help="ELF file of the running image")
+    parser.add_argument("output", help="Chrome trace JSON file written")
+    parser.add_argument("--dump", help="read the recorder from this binary dump, not the target")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    if "trace_rec" not in elf.symbols:
+        raise ValueError("{}: no trace_rec, build with TRACE_REC_ENABLED".format(args.elf))
+
+    if args.dump:
+        with open(args.dump, "rb") as f:
+            data = f.read()
+    else:
+        data = read_target(elf.symbols["trace_rec"])
+
+    freq, names, events, lost = parse(data)
+    trace, span = convert(elf, freq, names, events)
+    with open(args.output, "w") as f:
+        json.dump(trace, f, indent=0)
+        f.write("\n")
+
+    print("{} events over {:.1f} ms, {} older ones overwritten".format(len(events), span / 1000,
+                                                                       lost))
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except (IOError, ValueError, subprocess.CalledProcessError) as e:
+        sys.stderr.write("{}\n".format(e))
+        sys.exit(1)
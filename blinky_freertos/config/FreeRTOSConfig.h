@@ -63,8 +63,7 @@
 #define configTICK_RATE_HZ                                                        1024
 #define configMAX_PRIORITIES                                                      ( 3 )
 #define configMINIMAL_STACK_SIZE                                                  ( 60 )
-#define configTOTAL_HEAP_SIZE                                                     ( 4096 )
-#define configMAX_TASK_NAME_LEN                                                   ( 4 )
+#define configMAX_TASK_NAME_LEN                                                   ( 8 )
 #define configUSE_16_BIT_TICKS                                                    0
 #define configIDLE_SHOULD_YIELD                                                   1
 #define configUSE_MUTEXES                                                         1
@@ -77,15 +76,21 @@
 #define configUSE_NEWLIB_REENTRANT                                                0
 #define configENABLE_BACKWARD_COMPATIBILITY                                       1
 
+/* Memory allocation related definitions. Kernel objects are allocated statically by the
+application, there is no heap: RAM usage is known at link time. */
+#define configSUPPORT_STATIC_ALLOCATION                                           1
+#define configSUPPORT_DYNAMIC_ALLOCATION                                          0
+
 /* Hook function related definitions. */
-#define configUSE_IDLE_HOOK                                                       0
+#define configUSE_IDLE_HOOK                                                       1
 #define configUSE_TICK_HOOK                                                       0
 #define configCHECK_FOR_STACK_OVERFLOW                                            0
 #define configUSE_MALLOC_FAILED_HOOK                                              0
 
-/* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS                                             0
-#define configUSE_TRACE_FACILITY                                                  0
+/* Run time and task stats gathering related definitions. The run-time counter and the CPU load
+reporter are in cpu_load.c, see CPU_LOAD_* in sdk_config.h. */
+#define configGENERATE_RUN_TIME_STATS                                             1
+#define configUSE_TRACE_FACILITY                                                  1
 #define configUSE_STATS_FORMATTING_FUNCTIONS                                      0
 
 /* Co-routine definitions. */
@@ -184,6 +189,98 @@ standard names - or at least those used in the unmodified vector table. */
         #error "This port requires __NVIC_PRIO_BITS to be defined"
     #endif
 
+    #if configGENERATE_RUN_TIME_STATS
+        #include <stdint.h>
+        void     cpu_load_timer_init(void);
+        uint32_t cpu_load_timer_get(void);
+        #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()  cpu_load_timer_init()
+        #define portGET_RUN_TIME_COUNTER_VALUE()          cpu_load_timer_get()
+    #endif
+
+    #include "sdk_config.h"
+    #if SLEEP_STATS_ENABLED
+        /* Tickless idle statistics, see sleep_stats.h. Called with interrupts masked. */
+        #include <stdint.h>
+        void sleep_stats_pre_sleep(uint32_t expected);
+        void sleep_stats_post_sleep(uint32_t expected);
+        void sleep_stats_task_switched_in(void);
+        #define configPRE_SLEEP_PROCESSING(x)       sleep_stats_pre_sleep(x)
+        #define configPOST_SLEEP_PROCESSING(x)      sleep_stats_post_sleep(x)
+        #define SLEEP_STATS_TASK_SWITCHED_IN()      sleep_stats_task_switched_in()
+    #else
+        #define SLEEP_STATS_TASK_SWITCHED_IN()
+    #endif
+
+    #if MSG_CHANNEL_BENCH_ENABLED
+        void msg_channel_bench_task_switched_in(void);
+        #define MSG_CHANNEL_BENCH_TASK_SWITCHED_IN() msg_channel_bench_task_switched_in()
+    #else
+        #define MSG_CHANNEL_BENCH_TASK_SWITCHED_IN()
+    #endif
+
+    #if PERIODIC_WORK_BENCH_ENABLED
+        void periodic_work_bench_tick(void);
+        #define traceTASK_INCREMENT_TICK(x)         periodic_work_bench_tick()
+    #endif
+
+    #if TRACE_REC_ENABLED
+        /* Scheduling trace, see trace_rec.h. The macros expand in tasks.c and queue.c, where
+           the task control block and the local names they use are visible. */
+        #include "trace_rec.h"
+        #define TRACE_REC_TASK_SWITCHED_IN()                                        \
+            trace_rec_task_switch(TRACE_REC_TASK_IN, pxCurrentTCB->uxTCBNumber)
+        #define traceTASK_SWITCHED_OUT()                                            \
+            trace_rec_task_switch(TRACE_REC_TASK_OUT, pxCurrentTCB->uxTCBNumber)
+        #define TRACE_REC_TASK_CREATE(pxNewTCB)                                     \
+            trace_rec_task_create((pxNewTCB)->uxTCBNumber, (pxNewTCB)->pcTaskName)
+        #define traceQUEUE_SEND(pxQueue)            trace_rec_queue(TRACE_REC_QUEUE_SEND, pxQueue)
+        #define traceQUEUE_SEND_FROM_ISR(pxQueue)   trace_rec_queue(TRACE_REC_QUEUE_SEND, pxQueue)
+        #define traceQUEUE_RECEIVE(pxQueue)         trace_rec_queue(TRACE_REC_QUEUE_RECEIVE, pxQueue)
+        #define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)                                \
+            trace_rec_queue(TRACE_REC_QUEUE_RECEIVE, pxQueue)
+        #define traceBLOCKING_ON_QUEUE_SEND(pxQueue)                                \
+            trace_rec_queue(TRACE_REC_BLOCK_SEND, pxQueue)
+        #define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)                             \
+            trace_rec_queue(TRACE_REC_BLOCK_RECEIVE, pxQueue)
+        #define traceTASK_NOTIFY()                  trace_rec_notify(pxTCB->uxTCBNumber)
+        #define traceTASK_NOTIFY_FROM_ISR()         trace_rec_notify(pxTCB->uxTCBNumber)
+        #define traceTASK_NOTIFY_GIVE_FROM_ISR()    trace_rec_notify(pxTCB->uxTCBNumber)
+    #else
+        #define TRACE_REC_TASK_SWITCHED_IN()
+        #define TRACE_REC_TASK_CREATE(pxNewTCB)
+    #endif
+
+    #if STACK_USAGE_ENABLED
+        /* Stack usage report, see stack_usage.h. The stack size is known from its bounds. */
+        #include "stack_usage.h"
+        #define configRECORD_STACK_HIGH_ADDRESS     1
+        #define STACK_USAGE_TASK_CREATE(pxNewTCB)                                   \
+            stack_usage_task_create((pxNewTCB),                                     \
+                                    (uint32_t)((pxNewTCB)->pxEndOfStack - (pxNewTCB)->pxStack) + 1)
+        #define traceTASK_DELETE(pxTCB)             stack_usage_task_delete(pxTCB)
+    #else
+        #define STACK_USAGE_TASK_CREATE(pxNewTCB)
+    #endif
+
+    /* Task creation hooks of trace_rec and stack_usage, in prvAddNewTaskToReadyList() in a
+       critical section. */
+    #define traceTASK_CREATE(pxNewTCB)              \
+        do                                          \
+        {                                           \
+            TRACE_REC_TASK_CREATE(pxNewTCB);        \
+            STACK_USAGE_TASK_CREATE(pxNewTCB);      \
+        } while (0)
+
+    /* Task switch hooks of sleep_stats, msg_channel_bench and trace_rec, in vTaskSwitchContext()
+       with interrupts masked. */
+    #define traceTASK_SWITCHED_IN()                 \
+        do                                          \
+        {                                           \
+            SLEEP_STATS_TASK_SWITCHED_IN();         \
+            MSG_CHANNEL_BENCH_TASK_SWITCHED_IN();   \
+            TRACE_REC_TASK_SWITCHED_IN();           \
+        } while (0)
+
     /* Access to current system core clock is required only if we are ticking the system by systimer */
     #if (configTICK_SOURCE == FREERTOS_USE_SYSTICK)
         #include <stdint.h>
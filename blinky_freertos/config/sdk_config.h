@@ -46,6 +46,166 @@
 #ifdef USE_APP_CONFIG
 #include "app_config.h"
 #endif
+// <h> Application
+
+//==========================================================
+// <h> cpu_load - FreeRTOS run-time statistics and CPU load reporter
+
+// <i> Enabled by configGENERATE_RUN_TIME_STATS in FreeRTOSConfig.h.
+//==========================================================
+// <o> CPU_LOAD_TIMER_SOURCE - Run-time counter.
+
+// <i> CYCCNT counts CPU cycles and stops while the CPU sleeps, so the idle task only gets the
+// <i> cycles it runs. TIMER counts microseconds in sleep too, at the cost of keeping HFCLK on.
+// <0=> CYCCNT
+// <1=> TIMER
+
+#ifndef CPU_LOAD_TIMER_SOURCE
+#define CPU_LOAD_TIMER_SOURCE 1
+#endif
+
+// <o> CPU_LOAD_TIMER_INSTANCE - TIMER instance used as run-time counter.
+#ifndef CPU_LOAD_TIMER_INSTANCE
+#define CPU_LOAD_TIMER_INSTANCE 1
+#endif
+
+// <o> CPU_LOAD_REPORT_INTERVAL_MS - Interval of the reports in milliseconds.
+// <i> Must be shorter than a counter wrap (67 s for CYCCNT).
+#ifndef CPU_LOAD_REPORT_INTERVAL_MS
+#define CPU_LOAD_REPORT_INTERVAL_MS 5000
+#endif
+
+// <o> CPU_LOAD_MAX_TASKS - Maximum number of tasks reported.
+#ifndef CPU_LOAD_MAX_TASKS
+#define CPU_LOAD_MAX_TASKS 8
+#endif
+
+// </h>
+//==========================================================
+
+// <q> SLEEP_STATS_ENABLED  - sleep_stats - Tickless idle sleep and wakeup statistics
+ 
+// <i> Sleep durations, early and late wakeups and wakeup latency, logged with the CPU load
+// <i> reports. Needs configUSE_TICKLESS_IDLE and configGENERATE_RUN_TIME_STATS.
+
+#ifndef SLEEP_STATS_ENABLED
+#define SLEEP_STATS_ENABLED 1
+#endif
+
+// <e> MSG_CHANNEL_BENCH_ENABLED - msg_channel_bench - Message channel throughput benchmark
+
+// <i> Runs once at boot, zero-copy channel against a copying queue, results logged.
+//==========================================================
+#ifndef MSG_CHANNEL_BENCH_ENABLED
+#define MSG_CHANNEL_BENCH_ENABLED 0
+#endif
+// <o> MSG_CHANNEL_BENCH_MSGS - Messages per run.
+#ifndef MSG_CHANNEL_BENCH_MSGS
+#define MSG_CHANNEL_BENCH_MSGS 10000
+#endif
+
+// <o> MSG_CHANNEL_BENCH_SIZE - Message size in bytes. <4-1024>
+#ifndef MSG_CHANNEL_BENCH_SIZE
+#define MSG_CHANNEL_BENCH_SIZE 32
+#endif
+
+// <o> MSG_CHANNEL_BENCH_DELAY_MS - Delay from boot to the first run in milliseconds.
+#ifndef MSG_CHANNEL_BENCH_DELAY_MS
+#define MSG_CHANNEL_BENCH_DELAY_MS 1000
+#endif
+
+// </e>
+
+// <e> PERIODIC_WORK_ENABLED - periodic_work - Tasks notified periodically from RTC2
+//==========================================================
+#ifndef PERIODIC_WORK_ENABLED
+#define PERIODIC_WORK_ENABLED 1
+#endif
+// <o> PERIODIC_WORK_IRQ_PRIORITY  - RTC2 interrupt priority
+
+// <i> Must not be above configMAX_SYSCALL_INTERRUPT_PRIORITY (_PRIO_APP_HIGH), the
+// <i> interrupt calls xTaskNotifyFromISR().
+// <2=> 2
+// <3=> 3
+// <4=> 4
+// <5=> 5
+// <6=> 6
+// <7=> 7
+
+#ifndef PERIODIC_WORK_IRQ_PRIORITY
+#define PERIODIC_WORK_IRQ_PRIORITY 6
+#endif
+
+// <e> PERIODIC_WORK_BENCH_ENABLED - Wakeup latency benchmark against software timers
+
+// <i> Runs once at boot, results logged.
+//==========================================================
+#ifndef PERIODIC_WORK_BENCH_ENABLED
+#define PERIODIC_WORK_BENCH_ENABLED 0
+#endif
+// <o> PERIODIC_WORK_BENCH_PERIOD_MS - Period of the wakeups in milliseconds.
+#ifndef PERIODIC_WORK_BENCH_PERIOD_MS
+#define PERIODIC_WORK_BENCH_PERIOD_MS 20
+#endif
+
+// <o> PERIODIC_WORK_BENCH_SAMPLES - Wakeups per path.
+#ifndef PERIODIC_WORK_BENCH_SAMPLES
+#define PERIODIC_WORK_BENCH_SAMPLES 64
+#endif
+
+// <o> PERIODIC_WORK_BENCH_DELAY_MS - Delay from boot to the first run in milliseconds.
+#ifndef PERIODIC_WORK_BENCH_DELAY_MS
+#define PERIODIC_WORK_BENCH_DELAY_MS 1000
+#endif
+
+// </e>
+
+// </e>
+
+// <e> TRACE_REC_ENABLED - trace_rec - Scheduling event trace recorder
+
+// <i> Task switches, queue operations, notifications and instrumented interrupts in a RAM
+// <i> ring buffer, read and converted by apps/trace/trace_convert.py.
+// <i> Needs configGENERATE_RUN_TIME_STATS and configUSE_TRACE_FACILITY.
+//==========================================================
+#ifndef TRACE_REC_ENABLED
+#define TRACE_REC_ENABLED 0
+#endif
+// <o> TRACE_REC_EVENTS - Events kept, a power of two. 8 bytes each.
+#ifndef TRACE_REC_EVENTS
+#define TRACE_REC_EVENTS 1024
+#endif
+
+// <o> TRACE_REC_MAX_TASKS - Tasks whose names are kept.
+#ifndef TRACE_REC_MAX_TASKS
+#define TRACE_REC_MAX_TASKS 8
+#endif
+
+// </e>
+
+// <e> STACK_USAGE_ENABLED - stack_usage - Peak stack usage and recommended stack sizes
+
+// <i> High water marks of the painted task stacks, logged with the CPU load reports along with
+// <i> the stack size recommended for every task. Needs configGENERATE_RUN_TIME_STATS.
+//==========================================================
+#ifndef STACK_USAGE_ENABLED
+#define STACK_USAGE_ENABLED 0
+#endif
+// <o> STACK_USAGE_MAX_TASKS - Tasks reported at most.
+#ifndef STACK_USAGE_MAX_TASKS
+#define STACK_USAGE_MAX_TASKS 8
+#endif
+
+// <o> STACK_USAGE_MARGIN_PERCENT - Margin over the peak usage of the recommended sizes.
+#ifndef STACK_USAGE_MARGIN_PERCENT
+#define STACK_USAGE_MARGIN_PERCENT 25
+#endif
+
+// </e>
+
+// </h>
+//==========================================================
+
 // <h> nRF_Drivers 
 
 //==========================================================
@@ -508,10 +668,43 @@
 // <h> nRF_Log 
 
 //==========================================================
+// <e> NRF_LOG_BACKEND_RTT_ENABLED - nrf_log_backend_rtt - Log RTT backend
+//==========================================================
+#ifndef NRF_LOG_BACKEND_RTT_ENABLED
+#define NRF_LOG_BACKEND_RTT_ENABLED 1
+#endif
+// <o> NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE - Size of buffer for partially processed strings. 
+// <i> Size of the buffer is a trade-off between RAM usage and processing.
+// <i> if buffer is smaller then strings will often be fragmented.
+// <i> It is recommended to use size which will fit typical log and only the
+// <i> longer one will be fragmented.
+
+#ifndef NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE
+#define NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE 64
+#endif
+
+// <o> NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS - Period before retrying writing to RTT 
+#ifndef NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS
+#define NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS 1
+#endif
+
+// <o> NRF_LOG_BACKEND_RTT_TX_RETRY_CNT - Writing to RTT retries. 
+// <i> If RTT fails to accept any new data after retries
+// <i> module assumes that host is not active and on next
+// <i> request it will perform only one write attempt.
+// <i> On successful writing, module assumes that host is active
+// <i> and scheme with retry is applied again.
+
+#ifndef NRF_LOG_BACKEND_RTT_TX_RETRY_CNT
+#define NRF_LOG_BACKEND_RTT_TX_RETRY_CNT 3
+#endif
+
+// </e>
+
 // <e> NRF_LOG_ENABLED - nrf_log - Logger
 //==========================================================
 #ifndef NRF_LOG_ENABLED
-#define NRF_LOG_ENABLED 0
+#define NRF_LOG_ENABLED 1
 #endif
 // <h> Log message pool - Configuration of log message pool
 
@@ -624,7 +817,7 @@
 // <1024=> 1024 
 
 #ifndef NRF_LOG_STR_PUSH_BUFFER_SIZE
-#define NRF_LOG_STR_PUSH_BUFFER_SIZE 128
+#define NRF_LOG_STR_PUSH_BUFFER_SIZE 1024
 #endif
 
 // <o> NRF_LOG_STR_PUSH_BUFFER_SIZE  - Size of the buffer dedicated for strings stored using @ref NRF_LOG_PUSH.
@@ -638,7 +831,7 @@
 // <1024=> 1024 
 
 #ifndef NRF_LOG_STR_PUSH_BUFFER_SIZE
-#define NRF_LOG_STR_PUSH_BUFFER_SIZE 128
+#define NRF_LOG_STR_PUSH_BUFFER_SIZE 1024
 #endif
 
 // <e> NRF_LOG_USES_COLORS - If enabled then ANSI escape code for colors is prefixed to every string
@@ -3468,6 +3661,56 @@
 // </h> 
 //==========================================================
 
+// <h> nRF_Segger_RTT 
+
+//==========================================================
+// <h> segger_rtt - SEGGER RTT
+
+//==========================================================
+// <o> SEGGER_RTT_CONFIG_BUFFER_SIZE_UP - Size of upstream buffer. 
+// <i> Note that either @ref NRF_LOG_BACKEND_RTT_OUTPUT_BUFFER_SIZE
+// <i> or this value is actually used. It depends on which one is bigger.
+
+#ifndef SEGGER_RTT_CONFIG_BUFFER_SIZE_UP
+#define SEGGER_RTT_CONFIG_BUFFER_SIZE_UP 512
+#endif
+
+// <o> SEGGER_RTT_CONFIG_MAX_NUM_UP_BUFFERS - Maximum number of upstream buffers. 
+#ifndef SEGGER_RTT_CONFIG_MAX_NUM_UP_BUFFERS
+#define SEGGER_RTT_CONFIG_MAX_NUM_UP_BUFFERS 2
+#endif
+
+// <o> SEGGER_RTT_CONFIG_BUFFER_SIZE_DOWN - Size of downstream buffer. 
+#ifndef SEGGER_RTT_CONFIG_BUFFER_SIZE_DOWN
+#define SEGGER_RTT_CONFIG_BUFFER_SIZE_DOWN 16
+#endif
+
+// <o> SEGGER_RTT_CONFIG_MAX_NUM_DOWN_BUFFERS - Maximum number of downstream buffers. 
+#ifndef SEGGER_RTT_CONFIG_MAX_NUM_DOWN_BUFFERS
+#define SEGGER_RTT_CONFIG_MAX_NUM_DOWN_BUFFERS 2
+#endif
+
+// <o> SEGGER_RTT_CONFIG_DEFAULT_MODE  - RTT behavior if the buffer is full.
+ 
+
+// <i> The following modes are supported:
+// <i> - SKIP  - Do not block, output nothing.
+// <i> - TRIM  - Do not block, output as much as fits.
+// <i> - BLOCK - Wait until there is space in the buffer.
+// <0=> SKIP 
+// <1=> TRIM 
+// <2=> BLOCK_IF_FIFO_FULL 
+
+#ifndef SEGGER_RTT_CONFIG_DEFAULT_MODE
+#define SEGGER_RTT_CONFIG_DEFAULT_MODE 0
+#endif
+
+// </h> 
+//==========================================================
+
+// </h> 
+//==========================================================
+
 // <<< end of configuration section >>>
 #endif //SDK_CONFIG_H
 
@@ -0,0 +1,169 @@
+/**@file
+ * @ingroup cpu_load
+ */
+#include "sdk_common.h"
+#include "cpu_load.h"
+#include "sleep_stats.h"
+#include "stack_usage.h"
+
+#if configGENERATE_RUN_TIME_STATS
+
+#include "task.h"
+#include "nrf.h"
+#include "bench_dwt.h"
+#include "nrf_timer.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+
+#define TASK_STACK_SIZE     256     /* Words, log processing runs in the task. */
+
+#if (CPU_LOAD_TIMER_SOURCE == 0)
+#define COUNTER_FREQ        SystemCoreClock
+STATIC_ASSERT(CPU_LOAD_REPORT_INTERVAL_MS < 60000);
+#else
+#define COUNTER_FREQ        1000000
+#define TIMER               CONCAT_2(NRF_TIMER, CPU_LOAD_TIMER_INSTANCE)
+#endif
+
+/* Run-time of every task at the previous report, by task number. */
+typedef struct
+{
+    UBaseType_t number;
+    uint32_t    run_time;
+} task_time_t;
+
+static StaticTask_t m_task_tcb;
+static StackType_t  m_task_stack[TASK_STACK_SIZE];
+
+static TaskStatus_t m_status[CPU_LOAD_MAX_TASKS];
+static task_time_t  m_last[CPU_LOAD_MAX_TASKS];
+static UBaseType_t  m_last_cnt;
+static uint32_t     m_last_total;
+
+void cpu_load_timer_init(void)
+{
+#if (CPU_LOAD_TIMER_SOURCE == 0)
+    bench_dwt_enable();
+#else
+    nrf_timer_mode_set(TIMER, NRF_TIMER_MODE_TIMER);
+    nrf_timer_bit_width_set(TIMER, NRF_TIMER_BIT_WIDTH_32);
+    nrf_timer_frequency_set(TIMER, NRF_TIMER_FREQ_1MHz);
+    nrf_timer_task_trigger(TIMER, NRF_TIMER_TASK_CLEAR);
+    nrf_timer_task_trigger(TIMER, NRF_TIMER_TASK_START);
+#endif
+}
+
+uint32_t cpu_load_timer_get(void)
+{
+#if (CPU_LOAD_TIMER_SOURCE == 0)
+    return DWT->CYCCNT;
+#else
+    /* An interrupt capturing between the capture and the read of a task only makes the value
+       a little later. */
+    nrf_timer_task_trigger(TIMER, NRF_TIMER_TASK_CAPTURE0);
+    return nrf_timer_cc_read(TIMER, NRF_TIMER_CC_CHANNEL0);
+#endif
+}
+
+static uint32_t last_run_time_get(UBaseType_t number)
+{
+    for (UBaseType_t i = 0; i < m_last_cnt; i++)
+    {
+        if (m_last[i].number == number)
+        {
+            return m_last[i].run_time;
+        }
+    }
+    return 0;   /* Created since the last report. */
+}
+
+/* Share of the elapsed time in tenths of a percent. */
+static uint32_t permille(uint32_t time, uint32_t elapsed)
+{
+    return (uint32_t)((((uint64_t)time * 1000) + (elapsed / 2)) / elapsed);
+}
+
+static void report(void)
+{
+    uint32_t    total;
+    UBaseType_t cnt = uxTaskGetSystemState(m_status, ARRAY_SIZE(m_status), &total);
+
+    if (cnt == 0)
+    {
+        NRF_LOG_WARNING("cpu: more than %u tasks, increase CPU_LOAD_MAX_TASKS",
+                        CPU_LOAD_MAX_TASKS);
+        return;
+    }
+
+    /* Run-times wrap with the counter, differences are right within one wrap. */
+    uint32_t     elapsed = total - m_last_total;
+    TaskHandle_t idle    = xTaskGetIdleTaskHandle();
+    uint32_t     idle_pm = 0;
+
+    if (elapsed == 0)
+    {
+        return;
+    }
+
+    for (UBaseType_t i = 0; i < cnt; i++)
+    {
+        if (m_status[i].xHandle == idle)
+        {
+            idle_pm = permille(m_status[i].ulRunTimeCounter -
+                               last_run_time_get(m_status[i].xTaskNumber), elapsed);
+        }
+    }
+
+    NRF_LOG_INFO("cpu interval=%u idle=%u.%u%% busy=%u.%u%%",
+                 (uint32_t)(((uint64_t)elapsed * 1000) / COUNTER_FREQ),
+                 idle_pm / 10, idle_pm % 10,
+                 (1000 - MIN(idle_pm, 1000)) / 10, (1000 - MIN(idle_pm, 1000)) % 10);
+
+    for (UBaseType_t i = 0; i < cnt; i++)
+    {
+        uint32_t pm = permille(m_status[i].ulRunTimeCounter -
+                               last_run_time_get(m_status[i].xTaskNumber), elapsed);
+
+        NRF_LOG_INFO("cpu task=%s prio=%u load=%u.%u%%",
+                     NRF_LOG_PUSH((char *)m_status[i].pcTaskName),
+                     m_status[i].uxCurrentPriority, pm / 10, pm % 10);
+    }
+
+    for (UBaseType_t i = 0; i < cnt; i++)
+    {
+        m_last[i].number   = m_status[i].xTaskNumber;
+        m_last[i].run_time = m_status[i].ulRunTimeCounter;
+    }
+    m_last_cnt   = cnt;
+    m_last_total = total;
+
+#if SLEEP_STATS_ENABLED
+    sleep_stats_log();
+#endif
+#if STACK_USAGE_ENABLED
+    stack_usage_log();
+#endif
+}
+
+static void cpu_load_task(void * p_context)
+{
+    TickType_t wake = xTaskGetTickCount();
+
+    UNUSED_PARAMETER(p_context);
+
+    while (true)
+    {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(CPU_LOAD_REPORT_INTERVAL_MS));
+        report();
+    }
+}
+
+BaseType_t cpu_load_task_create(UBaseType_t priority)
+{
+    TaskHandle_t task = xTaskCreateStatic(cpu_load_task, "CPU", TASK_STACK_SIZE, NULL, priority,
+                                          m_task_stack, &m_task_tcb);
+
+    return (task != NULL) ? pdPASS : pdFAIL;
+}
+
+#endif // configGENERATE_RUN_TIME_STATS
@@ -0,0 +1,56 @@
+/** @file
+ * @defgroup cpu_load CPU load
+ * @{
+ * @ingroup blinky_example_freertos
+ *
+ * @brief FreeRTOS run-time statistics counter and a task reporting the CPU load per task.
+ *
+ * With configGENERATE_RUN_TIME_STATS set, FreeRTOS adds the time elapsed on the run-time counter
+ * to the task being switched out at every context switch. The counter is CYCCNT or a TIMER
+ * counting microseconds, selected by @ref CPU_LOAD_TIMER_SOURCE. Every
+ * @ref CPU_LOAD_REPORT_INTERVAL_MS the reporter task logs the share of each task in the elapsed
+ * time, and the share of the idle task as idle ratio, the headroom left for more work. The
+ * interval is given in milliseconds:
+ *
+ *     cpu interval=5000 idle=98.7% busy=1.3%
+ *     cpu task=LED0 prio=2 load=0.2%
+ *     cpu task=IDLE prio=0 load=98.7%
+ *
+ * Shares are given in tenths of a percent. The idle task includes the time spent sleeping in
+ * tickless idle with the TIMER source only, CYCCNT stops while the CPU sleeps.
+ */
+#ifndef CPU_LOAD_H__
+#define CPU_LOAD_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for starting the run-time counter.
+ *
+ * Called by FreeRTOS from vTaskStartScheduler() through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS.
+ */
+void cpu_load_timer_init(void);
+
+/**@brief Function for reading the run-time counter, portGET_RUN_TIME_COUNTER_VALUE. */
+uint32_t cpu_load_timer_get(void);
+
+/**@brief Function for creating the reporter task.
+ *
+ * @param[in] priority Task priority, the lowest above the idle task is fine.
+ *
+ * @retval pdPASS Task created.
+ */
+BaseType_t cpu_load_task_create(UBaseType_t priority);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CPU_LOAD_H__
+
+/** @} */
@@ -15,21 +15,47 @@
 /*FreeRTOS kernel dependencies */
 #include "FreeRTOS.h"
 #include "task.h"
-#include "timers.h"
+#include "queue.h"
 /* nRF dependencies */
 #include "pca10059.h"
 #include "nrf_gpio.h"
 #include "nrf_drv_clock.h"
 #include "nrf_delay.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+#include "nrf_log_default_backends.h"
+
+#include "cpu_load.h"
+#include "msg_channel_bench.h"
+#include "periodic_work.h"
+#include "periodic_work_bench.h"
+#include "sleep_stats.h"
 
 #define TASK_DELAY        500          /** Task delay. Delays the task for x ms */
-#define TIMER_PERIOD      1000          /** Timer period. Timer will expire after x ms */
+#define LED2_PERIOD       1000          /** LED2_G toggle period in ms */
+#define LED2_WORK         0             /** Periodic work toggling LED2_G */
+#define LED2_BIT          1             /** Notification bit of LED2_WORK */
+#define CPU_LOAD_PRIORITY 1             /** Reporter priority, below the LED task */
+#define LOGGER_PRIORITY   1             /** Log processing priority, just above idle */
+#define BENCH_PRIORITY    2             /** Message channel benchmark priority, and one below */
+#define LED_TASK_STACK    (configMINIMAL_STACK_SIZE + 200)  /** LED task stack size in words */
+#define LOGGER_STACK      256           /** Logger task stack size in words, for the formatting */
 
 TaskHandle_t  task_handle;   /** Reference to FreeRTOS task. */
-TimerHandle_t timer_handle;  /** Reference to FreeRTOS timer. */
+
+/* Everything is allocated statically, RAM usage is known at link time. */
+static StaticTask_t  m_led_task_tcb;
+static StackType_t   m_led_task_stack[LED_TASK_STACK];
+
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+static TaskHandle_t  m_logger_task;
+static StaticTask_t  m_logger_task_tcb;
+static StackType_t   m_logger_task_stack[LOGGER_STACK];
+
+static void logger_task_function(void * pvParameter);
+#endif
 
 static void led_toggle_task_function (void * pvParameter);
-static void led_toggle_timer_callback (void * pvParameter);
 static void start_error_mode(void);
 
 int main(void)
@@ -50,25 +76,56 @@ int main(void)
         start_error_mode();
     }
 
-    /* Create task for LED2 blinking with priority set to 2 */
-    xTaskCreate(
+    /* Logger over RTT, for the CPU load reports */
+    err_code = NRF_LOG_INIT(NULL);
+    if (err_code != 0) {
+        start_error_mode();
+    }
+    NRF_LOG_DEFAULT_BACKENDS_INIT();
+
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+    /* Deferred log entries are processed when the system goes idle, not by the tasks logging */
+    m_logger_task = xTaskCreateStatic(logger_task_function, "LOG", LOGGER_STACK, NULL,
+                                      LOGGER_PRIORITY, m_logger_task_stack, &m_logger_task_tcb);
+#endif
+
+    /* Create task for LED blinking with priority set to 2 */
+    task_handle = xTaskCreateStatic(
         led_toggle_task_function,        // Task callback function
         "LED0",                          // Task Name
-        configMINIMAL_STACK_SIZE + 200,  // Stack size
+        LED_TASK_STACK,                  // Stack size
         NULL,                            // Task Parameters
         2,                               // Task Priority
-        &task_handle                     // Task Handle (by which the created task can be referenced)
+        m_led_task_stack,                // Stack
+        &m_led_task_tcb                  // Task control block
     );
 
-    /* Start timer for LED1 blinking */
-    timer_handle = xTimerCreate(
-        "LED1",                    // Timer Name
-        TIMER_PERIOD,              // Timer Period in ticks
-        pdTRUE,                    // Auto Reload
-        NULL,                      // Timer ID
-        led_toggle_timer_callback  // Timer Callback function
-    );
-    xTimerStart(timer_handle, 0);
+    /* LED2 blinking, the RTC2 interrupt notifies the LED task without the timer service task */
+    periodic_work_init();
+    periodic_work_start(LED2_WORK, task_handle, LED2_BIT, LED2_PERIOD);
+
+#if configGENERATE_RUN_TIME_STATS
+    /* Report the CPU load per task periodically */
+    if (cpu_load_task_create(CPU_LOAD_PRIORITY) != pdPASS) {
+        start_error_mode();
+    }
+#endif
+#if MSG_CHANNEL_BENCH_ENABLED
+    /* Message channel throughput, logged once after boot */
+    if (msg_channel_bench_create(BENCH_PRIORITY) != pdPASS) {
+        start_error_mode();
+    }
+#endif
+#if PERIODIC_WORK_BENCH_ENABLED
+    /* Wakeup latency of software timers and periodic work, logged once after boot */
+    if (periodic_work_bench_create(configTIMER_TASK_PRIORITY) != pdPASS) {
+        start_error_mode();
+    }
+#endif
+#if SLEEP_STATS_ENABLED
+    /* Sleep and wakeup statistics, logged with the CPU load */
+    sleep_stats_init();
+#endif
 
     /* Activate deep sleep mode */
     SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
@@ -99,29 +156,92 @@ static void start_error_mode(void)
 
 
 /**@brief LED0 task entry function.
+ *
+ * Toggles LED1_G every TASK_DELAY ticks and, in between, LED2_G when notified by its periodic
+ * work.
  *
  * @param[in] pvParameter   Pointer that will be used as the parameter for the task.
  */
 static void led_toggle_task_function (void * pvParameter)
 {
+    TickType_t next = xTaskGetTickCount();
+
     while (true)
     {
-        nrf_gpio_pin_toggle(LED1_G);
+        uint32_t   bits;
+        TickType_t left = next - xTaskGetTickCount();
+
+        /* Wait for a notification until the next toggle of LED1_G, not at all when late */
+        if (xTaskNotifyWait(0, UINT32_MAX, &bits, (left <= TASK_DELAY) ? left : 0) == pdPASS)
+        {
+            if (bits & LED2_BIT)
+            {
+                nrf_gpio_pin_toggle(LED2_G);
+            }
+            continue;
+        }
 
-        /* Delay a task for a given number of ticks */
-        vTaskDelay(TASK_DELAY);
+        nrf_gpio_pin_toggle(LED1_G);
+        next += TASK_DELAY;
 
         /* Tasks must be implemented to never return... */
     }
 }
 
-/**@brief The function to call when the LED1 FreeRTOS timer expires.
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+/**@brief Logger task entry function.
+ *
+ * Processes the pending log entries, then suspends itself until the idle hook resumes it, once
+ * per wakeup of the system.
  *
- * @param[in] pvParameter   Pointer that will be used as the parameter for the timer.
+ * @param[in] pvParameter   Unused.
  */
-static void led_toggle_timer_callback (void * pvParameter)
+static void logger_task_function(void * pvParameter)
+{
+    UNUSED_PARAMETER(pvParameter);
+
+    while (true)
+    {
+        while (NRF_LOG_PROCESS())
+        {
+        }
+        vTaskSuspend(NULL);
+    }
+}
+#endif
+
+/**@brief Idle hook, resumes the logger before the idle task sleeps. */
+void vApplicationIdleHook(void)
 {
-    nrf_gpio_pin_toggle(LED2_G);
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+    vTaskResume(m_logger_task);
+#endif
+}
+
+/**@brief Memory of the idle task, required with configSUPPORT_STATIC_ALLOCATION. */
+void vApplicationGetIdleTaskMemory(StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                   StackType_t ** ppxIdleTaskStackBuffer,
+                                   uint32_t *     pulIdleTaskStackSize)
+{
+    static StaticTask_t tcb;
+    static StackType_t  stack[configMINIMAL_STACK_SIZE];
+
+    *ppxIdleTaskTCBBuffer   = &tcb;
+    *ppxIdleTaskStackBuffer = stack;
+    *pulIdleTaskStackSize   = configMINIMAL_STACK_SIZE;
+}
+
+/**@brief Memory of the timer service task, required with configSUPPORT_STATIC_ALLOCATION. */
+void vApplicationGetTimerTaskMemory(StaticTask_t ** ppxTimerTaskTCBBuffer,
+                                    StackType_t ** ppxTimerTaskStackBuffer,
+                                    uint32_t *     pulTimerTaskStackSize)
+{
+    static StaticTask_t tcb;
+    static StackType_t  stack[configTIMER_TASK_STACK_DEPTH];
+
+    *ppxTimerTaskTCBBuffer   = &tcb;
+    *ppxTimerTaskStackBuffer = stack;
+    *pulTimerTaskStackSize   = configTIMER_TASK_STACK_DEPTH;
 }
 
 /** @} */
@@ -0,0 +1,59 @@
+/**@file
+ * @ingroup msg_channel
+ */
+#include "sdk_common.h"
+#include "msg_channel.h"
+
+ret_code_t msg_channel_init(msg_channel_t const * p_channel)
+{
+    ret_code_t err_code = nrf_balloc_init(p_channel->p_pool);
+
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_channel->p_cb->queue = xQueueCreateStatic(p_channel->depth, sizeof(void *),
+                                                p_channel->p_queue_storage,
+                                                &p_channel->p_cb->queue_buf);
+    return NRF_SUCCESS;
+}
+
+void * msg_channel_alloc(msg_channel_t const * p_channel)
+{
+    return nrf_balloc_alloc(p_channel->p_pool);
+}
+
+void msg_channel_free(msg_channel_t const * p_channel, void * p_msg)
+{
+    nrf_balloc_free(p_channel->p_pool, p_msg);
+}
+
+BaseType_t msg_channel_send(msg_channel_t const * p_channel, void * p_msg, TickType_t wait)
+{
+    if (xQueueSend(p_channel->p_cb->queue, &p_msg, wait) != pdPASS)
+    {
+        nrf_balloc_free(p_channel->p_pool, p_msg);
+        return pdFAIL;
+    }
+    return pdPASS;
+}
+
+BaseType_t msg_channel_send_from_isr(msg_channel_t const * p_channel,
+                                     void *                p_msg,
+                                     BaseType_t *          p_woken)
+{
+    if (xQueueSendFromISR(p_channel->p_cb->queue, &p_msg, p_woken) != pdPASS)
+    {
+        nrf_balloc_free(p_channel->p_pool, p_msg);
+        return pdFAIL;
+    }
+    return pdPASS;
+}
+
+void * msg_channel_receive(msg_channel_t const * p_channel, TickType_t wait)
+{
+    void * p_msg;
+
+    return (xQueueReceive(p_channel->p_cb->queue, &p_msg, wait) == pdPASS) ? p_msg : NULL;
+}
@@ -0,0 +1,134 @@
+/** @file
+ * @defgroup msg_channel Zero-copy message channel
+ * @{
+ * @ingroup blinky_example_freertos
+ *
+ * @brief Fixed size messages passed by pointer between tasks and interrupts.
+ *
+ * A channel is a pool of message blocks (nrf_balloc) and a FreeRTOS queue of pointers to them,
+ * both allocated statically by @ref MSG_CHANNEL_DEF. The producer allocates a block, writes the
+ * message in place and sends the pointer. The consumer receives the pointer, reads the message
+ * in place and frees the block. Only the pointer is copied by the queue, whatever the message
+ * size:
+ *
+ * @code
+ * MSG_CHANNEL_DEF(m_samples, sizeof(sample_t), 8);
+ *
+ * sample_t * p_sample = msg_channel_alloc(&m_samples);       // producer
+ * if (p_sample != NULL)
+ * {
+ *     sample_read(p_sample);
+ *     (void)msg_channel_send(&m_samples, p_sample, portMAX_DELAY);
+ * }
+ *
+ * sample_t * p_sample = msg_channel_receive(&m_samples, portMAX_DELAY);    // consumer
+ * usb_write(p_sample);
+ * msg_channel_free(&m_samples, p_sample);
+ * @endcode
+ *
+ * The pool has two blocks more than the queue depth, one being written by the producer and one
+ * being read by the consumer, so with one producer and one consumer allocation fails only when
+ * the consumer keeps blocks. Allocation and free do not block and can be used from interrupts.
+ */
+#ifndef MSG_CHANNEL_H__
+#define MSG_CHANNEL_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "nrf_balloc.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Channel control block, in RAM. */
+typedef struct
+{
+    QueueHandle_t queue;        //!< Queue of message pointers.
+    StaticQueue_t queue_buf;    //!< Queue memory.
+} msg_channel_cb_t;
+
+/**@brief Channel, defined by @ref MSG_CHANNEL_DEF. */
+typedef struct
+{
+    nrf_balloc_t const * p_pool;            //!< Message blocks.
+    msg_channel_cb_t *   p_cb;              //!< Control block.
+    uint8_t *            p_queue_storage;   //!< Queue storage, @p depth pointers.
+    uint8_t              depth;             //!< Queue depth.
+} msg_channel_t;
+
+/**@brief Macro for defining a channel.
+ *
+ * @param _name     Channel name.
+ * @param _msg_size Message size in bytes.
+ * @param _depth    Messages queued at most, up to 253.
+ */
+#define MSG_CHANNEL_DEF(_name, _msg_size, _depth)                                   \
+    STATIC_ASSERT(((_depth) > 0) && ((_depth) <= 253));                             \
+    NRF_BALLOC_DEF(CONCAT_2(_name, _pool), (_msg_size), (_depth) + 2);              \
+    static msg_channel_cb_t CONCAT_2(_name, _cb);                                   \
+    static uint8_t CONCAT_2(_name, _queue_storage)[(_depth) * sizeof(void *)];      \
+    static msg_channel_t const _name =                                              \
+    {                                                                               \
+        .p_pool          = &CONCAT_2(_name, _pool),                                 \
+        .p_cb            = &CONCAT_2(_name, _cb),                                   \
+        .p_queue_storage = CONCAT_2(_name, _queue_storage),                         \
+        .depth           = (_depth),                                                \
+    }
+
+/**@brief Function for initializing a channel.
+ *
+ * @retval NRF_SUCCESS Channel ready.
+ */
+ret_code_t msg_channel_init(msg_channel_t const * p_channel);
+
+/**@brief Function for allocating a message.
+ *
+ * @return Message, NULL if the pool is empty.
+ */
+void * msg_channel_alloc(msg_channel_t const * p_channel);
+
+/**@brief Function for freeing a message received from the channel, or allocated and not sent. */
+void msg_channel_free(msg_channel_t const * p_channel, void * p_msg);
+
+/**@brief Function for sending a message.
+ *
+ * The channel owns the message afterwards, it is freed if it cannot be sent.
+ *
+ * @param[in] p_channel Channel.
+ * @param[in] p_msg     Message from @ref msg_channel_alloc.
+ * @param[in] wait      Ticks to wait for room in the queue.
+ *
+ * @retval pdPASS Message queued.
+ * @retval pdFAIL Queue full, message freed.
+ */
+BaseType_t msg_channel_send(msg_channel_t const * p_channel, void * p_msg, TickType_t wait);
+
+/**@brief Function for sending a message from an interrupt, see @ref msg_channel_send.
+ *
+ * @param[out] p_woken Set to pdTRUE if a task of higher priority than the interrupted one was
+ *                     woken, pass it to portYIELD_FROM_ISR.
+ */
+BaseType_t msg_channel_send_from_isr(msg_channel_t const * p_channel,
+                                     void *                p_msg,
+                                     BaseType_t *          p_woken);
+
+/**@brief Function for receiving a message.
+ *
+ * @param[in] p_channel Channel.
+ * @param[in] wait      Ticks to wait for a message.
+ *
+ * @return Message, to be freed with @ref msg_channel_free. NULL if none came in time.
+ */
+void * msg_channel_receive(msg_channel_t const * p_channel, TickType_t wait);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MSG_CHANNEL_H__
+
+/** @} */
@@ -0,0 +1,196 @@
+/**@file
+ * @ingroup msg_channel_bench
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(MSG_CHANNEL_BENCH)
+#include "msg_channel_bench.h"
+
+#include <string.h>
+
+#include "task.h"
+#include "queue.h"
+#include "nrf.h"
+#include "bench_dwt.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+#include "msg_channel.h"
+
+#define TASK_STACK_SIZE     192     /* Words, the producer logs the results. */
+#define QUEUE_DEPTH         8
+
+STATIC_ASSERT(MSG_CHANNEL_BENCH_SIZE >= sizeof(uint32_t));
+
+typedef struct
+{
+    uint32_t seq;
+    uint8_t  payload[MSG_CHANNEL_BENCH_SIZE - sizeof(uint32_t)];
+} bench_msg_t;
+
+typedef struct
+{
+    char const * p_mode;
+    bool         copy;              /* Messages copied through a queue. */
+    bool         consumer_high;     /* Consumer above the producer. */
+} run_t;
+
+static run_t const m_runs[] =
+{
+    { "zero_copy", false, true  },
+    { "zero_copy", false, false },
+    { "copy",      true,  true  },
+    { "copy",      true,  false },
+};
+
+MSG_CHANNEL_DEF(m_channel, sizeof(bench_msg_t), QUEUE_DEPTH);
+
+static QueueHandle_t m_copy_queue;
+static StaticQueue_t m_copy_queue_buf;
+static uint8_t       m_copy_queue_storage[QUEUE_DEPTH * sizeof(bench_msg_t)];
+
+static StaticTask_t m_producer_tcb;
+static StackType_t  m_producer_stack[TASK_STACK_SIZE];
+static StaticTask_t m_consumer_tcb;
+static StackType_t  m_consumer_stack[TASK_STACK_SIZE];
+static TaskHandle_t m_producer;
+static TaskHandle_t m_consumer;
+static UBaseType_t  m_priority;
+
+static uint32_t volatile m_switches;
+static TaskHandle_t      m_last_task;
+static uint32_t          m_errors;      /* Messages out of sequence, written by the consumer. */
+
+void msg_channel_bench_task_switched_in(void)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+
+    if (task != m_last_task)
+    {
+        m_last_task = task;
+        m_switches++;
+    }
+}
+
+static void produce(bool copy)
+{
+    for (uint32_t seq = 0; seq < MSG_CHANNEL_BENCH_MSGS; seq++)
+    {
+        if (copy)
+        {
+            bench_msg_t msg;
+
+            msg.seq = seq;
+            memset(msg.payload, (uint8_t)seq, sizeof(msg.payload));
+            (void)xQueueSend(m_copy_queue, &msg, portMAX_DELAY);
+            continue;
+        }
+
+        bench_msg_t * p_msg;
+
+        /* Only empty while the consumer is behind with a full queue, let it catch up. */
+        while ((p_msg = msg_channel_alloc(&m_channel)) == NULL)
+        {
+            vTaskDelay(1);
+        }
+        p_msg->seq = seq;
+        memset(p_msg->payload, (uint8_t)seq, sizeof(p_msg->payload));
+        (void)msg_channel_send(&m_channel, p_msg, portMAX_DELAY);
+    }
+}
+
+static void consumer_task(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    while (true)
+    {
+        uint32_t run;
+
+        (void)xTaskNotifyWait(0, 0, &run, portMAX_DELAY);
+
+        for (uint32_t seq = 0; seq < MSG_CHANNEL_BENCH_MSGS; seq++)
+        {
+            if (m_runs[run].copy)
+            {
+                bench_msg_t msg;
+
+                (void)xQueueReceive(m_copy_queue, &msg, portMAX_DELAY);
+                m_errors += (msg.seq != seq);
+                continue;
+            }
+
+            bench_msg_t * p_msg = msg_channel_receive(&m_channel, portMAX_DELAY);
+
+            m_errors += (p_msg->seq != seq);
+            msg_channel_free(&m_channel, p_msg);
+        }
+
+        xTaskNotifyGive(m_producer);
+    }
+}
+
+static void producer_task(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    vTaskDelay(pdMS_TO_TICKS(MSG_CHANNEL_BENCH_DELAY_MS));
+
+    bench_dwt_enable();
+
+    for (uint32_t run = 0; run < ARRAY_SIZE(m_runs); run++)
+    {
+        run_t const * p_run = &m_runs[run];
+
+        vTaskPrioritySet(m_consumer, p_run->consumer_high ? m_priority : m_priority - 1);
+        vTaskPrioritySet(NULL, p_run->consumer_high ? m_priority - 1 : m_priority);
+        m_errors = 0;
+
+        /* A consumer above the producer starts waiting for the first message right away. */
+        (void)xTaskNotify(m_consumer, run, eSetValueWithOverwrite);
+
+        uint32_t switches = m_switches;
+        uint32_t start    = DWT->CYCCNT;
+
+        produce(p_run->copy);
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        uint32_t us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+        uint32_t sw = (uint32_t)(((uint64_t)(m_switches - switches) * 100) /
+                                 MSG_CHANNEL_BENCH_MSGS);
+
+        NRF_LOG_INFO("chan mode=%s consumer=%s size=%u msgs=%u us=%u rate=%u switches=%u.%02u",
+                     p_run->p_mode, p_run->consumer_high ? "high" : "low",
+                     MSG_CHANNEL_BENCH_SIZE, MSG_CHANNEL_BENCH_MSGS, us,
+                     (us != 0) ? (uint32_t)(((uint64_t)MSG_CHANNEL_BENCH_MSGS * 1000000) / us) : 0,
+                     sw / 100, sw % 100);
+        if (m_errors != 0)
+        {
+            NRF_LOG_ERROR("chan: %u messages out of sequence", m_errors);
+        }
+        NRF_LOG_FLUSH();
+    }
+
+    vTaskSuspend(m_consumer);
+    vTaskSuspend(NULL);
+}
+
+BaseType_t msg_channel_bench_create(UBaseType_t priority)
+{
+    ASSERT(priority > 1);
+
+    if (msg_channel_init(&m_channel) != NRF_SUCCESS)
+    {
+        return pdFAIL;
+    }
+
+    m_copy_queue = xQueueCreateStatic(QUEUE_DEPTH, sizeof(bench_msg_t), m_copy_queue_storage,
+                                      &m_copy_queue_buf);
+    m_priority   = priority;
+    m_producer   = xTaskCreateStatic(producer_task, "CHP", TASK_STACK_SIZE, NULL, priority,
+                                     m_producer_stack, &m_producer_tcb);
+    m_consumer   = xTaskCreateStatic(consumer_task, "CHC", TASK_STACK_SIZE, NULL, priority,
+                                     m_consumer_stack, &m_consumer_tcb);
+
+    return ((m_producer != NULL) && (m_consumer != NULL)) ? pdPASS : pdFAIL;
+}
+
+#endif // NRF_MODULE_ENABLED(MSG_CHANNEL_BENCH)
@@ -0,0 +1,49 @@
+/** @file
+ * @defgroup msg_channel_bench Message channel benchmark
+ * @{
+ * @ingroup msg_channel
+ *
+ * @brief Throughput of the zero-copy channel against a FreeRTOS queue copying the messages.
+ *
+ * A producer task sends @ref MSG_CHANNEL_BENCH_MSGS messages of @ref MSG_CHANNEL_BENCH_SIZE
+ * bytes to a consumer task, with the consumer above and below the producer in priority, through
+ * a @ref msg_channel and through a queue of the messages themselves. The producer writes every
+ * message, the consumer checks its sequence number. One line is logged per run, the time in
+ * microseconds, the messages per second and the context switches per message in hundredths:
+ *
+ *     chan mode=zero_copy consumer=high size=32 msgs=10000 us=98234 rate=101798 switches=2.00
+ *
+ * With the consumer above the producer every message costs a switch to the consumer and one
+ * back. With the consumer below, the producer fills the queue first, then is woken by every slot
+ * the consumer frees. Switches to other tasks during the run (LED, timer service) are counted
+ * too. The runs start once, @ref MSG_CHANNEL_BENCH_DELAY_MS after boot.
+ */
+#ifndef MSG_CHANNEL_BENCH_H__
+#define MSG_CHANNEL_BENCH_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for creating the benchmark tasks.
+ *
+ * @param[in] priority Higher of the two priorities used, the other one is one below.
+ *
+ * @retval pdPASS Tasks created.
+ */
+BaseType_t msg_channel_bench_create(UBaseType_t priority);
+
+/**@brief Task switch hook counting the switches, traceTASK_SWITCHED_IN. */
+void msg_channel_bench_task_switched_in(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MSG_CHANNEL_BENCH_H__
+
+/** @} */
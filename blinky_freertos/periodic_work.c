@@ -0,0 +1,146 @@
+/**@file
+ * @ingroup periodic_work
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(PERIODIC_WORK)
+#include "periodic_work.h"
+
+#include "nrf.h"
+#include "nrf_rtc.h"
+#include "app_util_platform.h"
+#include "trace_rec.h"
+
+/* RTC0 belongs to the SoftDevice and has three compare channels, RTC1 is the FreeRTOS tick. */
+#define RTC             NRF_RTC2
+#define RTC_IRQn        RTC2_IRQn
+#define RTC_IRQHandler  RTC2_IRQHandler
+#define RTC_FREQ        32768
+#define RTC_MASK        0x00FFFFFFUL
+#define RTC_MIN_DELTA   2           /* Compare values closer to the counter may not fire. */
+
+typedef struct
+{
+    TaskHandle_t task;
+    uint32_t     bits;
+    uint32_t     period_ms;
+    uint32_t     rem;               /* Remainder of the period in RTC ticks, in 1/1000 ticks. */
+    uint32_t     last_cyc;
+    uint32_t     missed;
+} work_t;
+
+static work_t m_works[PERIODIC_WORK_COUNT];
+
+/* Ticks to the next expiry, the fraction carried over so that the periods do not drift. */
+static uint32_t period_ticks(work_t * p_work)
+{
+    uint32_t scaled = p_work->period_ms * RTC_FREQ + p_work->rem;
+
+    p_work->rem = scaled % 1000;
+    return scaled / 1000;
+}
+
+static void compare_schedule(uint32_t idx, uint32_t cc)
+{
+    work_t * p_work   = &m_works[idx];
+    uint32_t max      = ((p_work->period_ms * RTC_FREQ) / 1000) + 1;
+    uint32_t distance = (cc - nrf_rtc_counter_get(RTC)) & RTC_MASK;
+
+    /* Late by more than a period, the compare value is behind the counter: skip to the next
+       expiry still ahead. */
+    while ((distance < RTC_MIN_DELTA) || (distance > max))
+    {
+        cc       = (cc + period_ticks(p_work)) & RTC_MASK;
+        distance = (cc - nrf_rtc_counter_get(RTC)) & RTC_MASK;
+        p_work->missed++;
+    }
+    nrf_rtc_cc_set(RTC, idx, cc);
+}
+
+void periodic_work_init(void)
+{
+    nrf_rtc_prescaler_set(RTC, 0);
+    NVIC_SetPriority(RTC_IRQn, PERIODIC_WORK_IRQ_PRIORITY);
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    NVIC_EnableIRQ(RTC_IRQn);
+    nrf_rtc_task_trigger(RTC, NRF_RTC_TASK_START);
+}
+
+void periodic_work_start(uint32_t idx, TaskHandle_t task, uint32_t bits, uint32_t period_ms)
+{
+    ASSERT(idx < PERIODIC_WORK_COUNT);
+    ASSERT((period_ms > 0) && (period_ms < 131072));   /* Ticks and fraction within 32 bits. */
+
+    nrf_rtc_event_t event = (nrf_rtc_event_t)NRF_RTC_CHANNEL_EVENT_ADDR(idx);
+    uint32_t        mask   = RTC_CHANNEL_INT_MASK(idx);
+    work_t *        p_work = &m_works[idx];
+
+    nrf_rtc_int_disable(RTC, mask);
+    nrf_rtc_event_disable(RTC, mask);
+    nrf_rtc_event_clear(RTC, event);
+
+    p_work->task      = task;
+    p_work->bits      = bits;
+    p_work->period_ms = period_ms;
+    p_work->rem       = 0;
+    p_work->missed    = 0;
+
+    compare_schedule(idx, (nrf_rtc_counter_get(RTC) + period_ticks(p_work)) & RTC_MASK);
+    nrf_rtc_event_enable(RTC, mask);
+    nrf_rtc_int_enable(RTC, mask);
+}
+
+void periodic_work_stop(uint32_t idx)
+{
+    ASSERT(idx < PERIODIC_WORK_COUNT);
+
+    uint32_t mask = RTC_CHANNEL_INT_MASK(idx);
+
+    nrf_rtc_int_disable(RTC, mask);
+    nrf_rtc_event_disable(RTC, mask);
+    nrf_rtc_event_clear(RTC, (nrf_rtc_event_t)NRF_RTC_CHANNEL_EVENT_ADDR(idx));
+}
+
+uint32_t periodic_work_last_cyc(uint32_t idx)
+{
+    return m_works[idx].last_cyc;
+}
+
+uint32_t periodic_work_missed(uint32_t idx)
+{
+    return m_works[idx].missed;
+}
+
+void RTC_IRQHandler(void)
+{
+    uint32_t   cyc   = DWT->CYCCNT;
+    BaseType_t woken = pdFALSE;
+
+#if TRACE_REC_ENABLED
+    trace_rec_isr_enter();
+#endif
+
+    for (uint32_t idx = 0; idx < PERIODIC_WORK_COUNT; idx++)
+    {
+        nrf_rtc_event_t event = (nrf_rtc_event_t)NRF_RTC_CHANNEL_EVENT_ADDR(idx);
+
+        if (!nrf_rtc_int_is_enabled(RTC, RTC_CHANNEL_INT_MASK(idx)) ||
+            !nrf_rtc_event_pending(RTC, event))
+        {
+            continue;
+        }
+        nrf_rtc_event_clear(RTC, event);
+
+        work_t * p_work = &m_works[idx];
+
+        p_work->last_cyc = cyc;
+        compare_schedule(idx, (nrf_rtc_cc_get(RTC, idx) + period_ticks(p_work)) & RTC_MASK);
+        (void)xTaskNotifyFromISR(p_work->task, p_work->bits, eSetBits, &woken);
+    }
+
+#if TRACE_REC_ENABLED
+    trace_rec_isr_exit();
+#endif
+    portYIELD_FROM_ISR(woken);
+}
+
+#endif // NRF_MODULE_ENABLED(PERIODIC_WORK)
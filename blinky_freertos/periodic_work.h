@@ -0,0 +1,81 @@
+/** @file
+ * @defgroup periodic_work Periodic work
+ * @{
+ * @ingroup blinky_example_freertos
+ *
+ * @brief Tasks woken periodically by an RTC compare interrupt, without the timer service task.
+ *
+ * A FreeRTOS software timer expires in the timer service task: the tick interrupt unblocks the
+ * service task, the service task runs the callback and the callback wakes the task doing the
+ * work. Here the compare interrupt of RTC2 sets notification bits of the task directly with
+ * xTaskNotifyFromISR(), one context switch instead of two:
+ *
+ * @code
+ * periodic_work_start(0, xTaskGetCurrentTaskHandle(), SAMPLE_BIT, 100);
+ *
+ * while (true)
+ * {
+ *     uint32_t bits;
+ *
+ *     (void)xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+ *     if (bits & SAMPLE_BIT)
+ *     {
+ *         sample();
+ *     }
+ * }
+ * @endcode
+ *
+ * Every compare channel of the RTC is one periodic work. The RTC runs from the 32.768 kHz LFCLK
+ * in sleep too, periods are kept without drift, each expiry is rounded to the nearest 30.5 us.
+ * An expiry missed by more than a period (interrupts masked for that long) is skipped.
+ */
+#ifndef PERIODIC_WORK_H__
+#define PERIODIC_WORK_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PERIODIC_WORK_COUNT     4   //!< Periodic works at most, compare channels of the RTC.
+
+/**@brief Function for starting the RTC.
+ *
+ * Can be called before the scheduler starts, the RTC counts once LFCLK runs.
+ */
+void periodic_work_init(void);
+
+/**@brief Function for starting a periodic work.
+ *
+ * @param[in] idx       Periodic work, less than @ref PERIODIC_WORK_COUNT.
+ * @param[in] task      Task notified.
+ * @param[in] bits      Notification bits set at every expiry.
+ * @param[in] period_ms Period in milliseconds, below 131072. The first expiry is one period from
+ *                      now.
+ */
+void periodic_work_start(uint32_t idx, TaskHandle_t task, uint32_t bits, uint32_t period_ms);
+
+/**@brief Function for stopping a periodic work. */
+void periodic_work_stop(uint32_t idx);
+
+/**@brief Function for getting the cycle counter at the last expiry handled.
+ *
+ * CYCCNT read on entry of the interrupt, for latency measurements. Only meaningful with the
+ * cycle counter running.
+ */
+uint32_t periodic_work_last_cyc(uint32_t idx);
+
+/**@brief Function for getting the number of expiries skipped because they were missed. */
+uint32_t periodic_work_missed(uint32_t idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PERIODIC_WORK_H__
+
+/** @} */
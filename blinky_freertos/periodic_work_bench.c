@@ -0,0 +1,127 @@
+/**@file
+ * @ingroup periodic_work_bench
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(PERIODIC_WORK_BENCH)
+#include "periodic_work_bench.h"
+
+#include "task.h"
+#include "timers.h"
+#include "nrf.h"
+#include "bench_dwt.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+#include "periodic_work.h"
+
+#define TASK_STACK_SIZE     192     /* Words, the task logs the results. */
+#define WORK_IDX            (PERIODIC_WORK_COUNT - 1)
+#define WAKE_BIT            1
+
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} latency_t;
+
+static StaticTask_t  m_task_tcb;
+static StackType_t   m_task_stack[TASK_STACK_SIZE];
+static TaskHandle_t  m_task;
+static StaticTimer_t m_timer_buf;
+
+static uint32_t volatile m_tick_cyc;    /* CYCCNT at the last tick interrupt. */
+static uint32_t volatile m_expiry_cyc;  /* Tick of the last timer expiry. */
+
+void periodic_work_bench_tick(void)
+{
+    m_tick_cyc = DWT->CYCCNT;
+}
+
+static void timer_callback(TimerHandle_t timer)
+{
+    UNUSED_PARAMETER(timer);
+
+    m_expiry_cyc = m_tick_cyc;
+    (void)xTaskNotify(m_task, WAKE_BIT, eSetBits);
+}
+
+static void latency_add(latency_t * p_latency, uint32_t cyc)
+{
+    p_latency->min  = MIN(p_latency->min, cyc);
+    p_latency->max  = MAX(p_latency->max, cyc);
+    p_latency->sum += cyc;
+}
+
+static void latency_log(char const * p_path, latency_t const * p_latency)
+{
+    /* Tenths of microseconds. */
+    uint32_t per_us = SystemCoreClock / 1000000;
+    uint32_t min    = (p_latency->min * 10) / per_us;
+    uint32_t mean   = (uint32_t)((p_latency->sum * 10) / (PERIODIC_WORK_BENCH_SAMPLES * per_us));
+    uint32_t max    = (p_latency->max * 10) / per_us;
+
+    NRF_LOG_INFO("pwork path=%s samples=%u min=%u.%u mean=%u.%u max=%u.%u",
+                 p_path, PERIODIC_WORK_BENCH_SAMPLES,
+                 min / 10, min % 10, mean / 10, mean % 10, max / 10, max % 10);
+    NRF_LOG_FLUSH();
+}
+
+/* Wakes up the samples, the start of each one read by p_start_get. */
+static void run(char const * p_path, uint32_t (*p_start_get)(void))
+{
+    latency_t latency = { .min = UINT32_MAX };
+
+    for (uint32_t i = 0; i < PERIODIC_WORK_BENCH_SAMPLES; i++)
+    {
+        (void)xTaskNotifyWait(0, UINT32_MAX, NULL, portMAX_DELAY);
+        latency_add(&latency, DWT->CYCCNT - p_start_get());
+    }
+
+    latency_log(p_path, &latency);
+}
+
+static uint32_t timer_start_get(void)
+{
+    return m_expiry_cyc;
+}
+
+static uint32_t rtc_start_get(void)
+{
+    return periodic_work_last_cyc(WORK_IDX);
+}
+
+static void bench_task(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    vTaskDelay(pdMS_TO_TICKS(PERIODIC_WORK_BENCH_DELAY_MS));
+
+    bench_dwt_enable();
+
+    TimerHandle_t timer = xTimerCreateStatic("PWB", pdMS_TO_TICKS(PERIODIC_WORK_BENCH_PERIOD_MS),
+                                             pdTRUE, NULL, timer_callback, &m_timer_buf);
+
+    (void)xTimerStart(timer, portMAX_DELAY);
+    run("timer", timer_start_get);
+    (void)xTimerStop(timer, portMAX_DELAY);
+
+    /* Drop an expiry that came before the timer service task processed the stop. */
+    vTaskDelay(pdMS_TO_TICKS(PERIODIC_WORK_BENCH_PERIOD_MS));
+    (void)xTaskNotifyStateClear(NULL);
+
+    periodic_work_start(WORK_IDX, m_task, WAKE_BIT, PERIODIC_WORK_BENCH_PERIOD_MS);
+    run("rtc", rtc_start_get);
+    periodic_work_stop(WORK_IDX);
+
+    vTaskSuspend(NULL);
+}
+
+BaseType_t periodic_work_bench_create(UBaseType_t priority)
+{
+    m_task = xTaskCreateStatic(bench_task, "PWB", TASK_STACK_SIZE, NULL, priority,
+                               m_task_stack, &m_task_tcb);
+
+    return (m_task != NULL) ? pdPASS : pdFAIL;
+}
+
+#endif // NRF_MODULE_ENABLED(PERIODIC_WORK_BENCH)
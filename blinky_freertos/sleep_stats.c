@@ -0,0 +1,141 @@
+/**@file
+ * @ingroup sleep_stats
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(SLEEP_STATS)
+#include "sleep_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "task.h"
+#include "nrf.h"
+#include "bench_dwt.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+
+#define HIST_BUCKETS    11                  /* 0, 1, 2-3, ... 512 and more. */
+#define LINE_SIZE       128
+#define RTC_MASK        0x00FFFFFFUL
+#define RTC_COUNTER()   (NRF_RTC1->COUNTER) /* Tick source of the port, one count per tick. */
+
+typedef struct
+{
+    uint32_t sleeps;                        /* Sleeps. */
+    uint32_t early;                         /* Fewer ticks than expected. */
+    uint32_t late;                          /* More ticks than expected. */
+    uint32_t slept;                         /* Ticks slept. */
+    uint32_t ticks_hist[HIST_BUCKETS];      /* Ticks slept. */
+    uint32_t late_hist[HIST_BUCKETS];       /* Ticks beyond the expected ones. */
+    uint32_t latency_hist[HIST_BUCKETS];    /* Microseconds from wakeup to a task running. */
+} stats_t;
+
+static stats_t    m_stats;
+static TickType_t m_start;                  /* Tick count at the last log. */
+static uint32_t   m_sleep_rtc;              /* RTC counter at the start of the sleep. */
+static uint32_t   m_wake_cyc;               /* CYCCNT at the end of the sleep. */
+static bool       m_latency_pending;
+
+static uint32_t bucket(uint32_t value)
+{
+    uint32_t idx = 0;
+
+    while ((value != 0) && (idx < (HIST_BUCKETS - 1)))
+    {
+        value >>= 1;
+        idx++;
+    }
+    return idx;
+}
+
+void sleep_stats_init(void)
+{
+    bench_dwt_enable();
+    m_start = xTaskGetTickCount();
+}
+
+void sleep_stats_pre_sleep(TickType_t expected)
+{
+    UNUSED_PARAMETER(expected);
+    m_sleep_rtc       = RTC_COUNTER();
+    m_latency_pending = false;
+}
+
+void sleep_stats_post_sleep(TickType_t expected)
+{
+    uint32_t slept = (RTC_COUNTER() - m_sleep_rtc) & RTC_MASK;
+
+    m_wake_cyc        = DWT->CYCCNT;
+    m_latency_pending = true;
+
+    m_stats.sleeps++;
+    m_stats.slept += slept;
+    m_stats.ticks_hist[bucket(slept)]++;
+    if (slept < expected)
+    {
+        m_stats.early++;
+    }
+    else if (slept > expected)
+    {
+        m_stats.late++;
+        m_stats.late_hist[bucket(slept - expected)]++;
+    }
+}
+
+void sleep_stats_task_switched_in(void)
+{
+    if (!m_latency_pending || (xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle()))
+    {
+        return;
+    }
+    m_latency_pending = false;
+
+    uint32_t us = (DWT->CYCCNT - m_wake_cyc) / (SystemCoreClock / 1000000);
+
+    m_stats.latency_hist[bucket(us)]++;
+}
+
+static void hist_log(char const * p_name, uint32_t const * p_hist)
+{
+    static char line[LINE_SIZE];
+    size_t      len = (size_t)snprintf(line, sizeof(line), "sleep %s", p_name);
+
+    for (uint32_t i = 0; (i < HIST_BUCKETS) && (len < sizeof(line)); i++)
+    {
+        if (p_hist[i] != 0)
+        {
+            len += (size_t)snprintf(&line[len], sizeof(line) - len, " %u:%u",
+                                    (unsigned)((i == 0) ? 0 : (1u << (i - 1))),
+                                    (unsigned)p_hist[i]);
+        }
+    }
+
+    /* The buffer is reused for the next histogram, the entry keeps a copy. */
+    NRF_LOG_INFO("%s", NRF_LOG_PUSH(line));
+}
+
+void sleep_stats_log(void)
+{
+    stats_t    stats;
+    TickType_t now;
+
+    taskENTER_CRITICAL();
+    stats = m_stats;
+    memset(&m_stats, 0, sizeof(m_stats));
+    now = xTaskGetTickCount();
+    taskEXIT_CRITICAL();
+
+    TickType_t elapsed = now - m_start;
+    uint32_t   pm      = (elapsed != 0) ?
+                         (uint32_t)(((uint64_t)stats.slept * 1000) / elapsed) : 0;
+
+    m_start = now;
+
+    NRF_LOG_INFO("sleep count=%u early=%u late=%u asleep=%u.%u%%",
+                 stats.sleeps, stats.early, stats.late, pm / 10, pm % 10);
+    hist_log("ticks", stats.ticks_hist);
+    hist_log("late ticks", stats.late_hist);
+    hist_log("latency us", stats.latency_hist);
+}
+
+#endif // NRF_MODULE_ENABLED(SLEEP_STATS)
@@ -0,0 +1,57 @@
+/** @file
+ * @defgroup sleep_stats Tickless idle statistics
+ * @{
+ * @ingroup blinky_example_freertos
+ *
+ * @brief Sleep durations, early and late wakeups and wakeup latency of tickless idle.
+ *
+ * The module hooks into the tickless idle path of the port through FreeRTOSConfig.h:
+ *
+ * - configPRE_SLEEP_PROCESSING and configPOST_SLEEP_PROCESSING give the ticks the kernel expects
+ *   to sleep and the ticks actually slept, read from the RTC1 counter (one count per tick).
+ *   Fewer is an early wakeup, by an interrupt other than the RTC compare. More is a late one,
+ *   the wakeup was handled a tick or more after the expected tick.
+ * - configPOST_SLEEP_PROCESSING and traceTASK_SWITCHED_IN give the wakeup latency: CPU cycles
+ *   from the end of the sleep to the first task other than idle running, in microseconds.
+ *
+ * Counts and histograms are logged and cleared by @ref sleep_stats_log, called by the CPU load
+ * reporter every CPU_LOAD_REPORT_INTERVAL_MS. Histogram buckets are powers of two, labeled with
+ * their lower bound:
+ *
+ *     sleep count=812 early=3 late=0 asleep=97.9%
+ *     sleep ticks 1:4 2:2 4:0 8:0 16:0 32:0 64:0 128:0 256:0 512:806
+ *     sleep late ticks
+ *     sleep latency us 8:806 16:2
+ *
+ * The sleep ratio is the share of ticks spent in tickless sleep, the measure to compare when
+ * tuning configTICK_RATE_HZ: a lower tick rate gives longer sleeps but coarser delays.
+ */
+#ifndef SLEEP_STATS_H__
+#define SLEEP_STATS_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for starting the cycle counter used for the latency. */
+void sleep_stats_init(void);
+
+/**@brief Function for logging the statistics since the last call and clearing them. */
+void sleep_stats_log(void);
+
+/* Hooks, see FreeRTOSConfig.h. Called with interrupts masked. */
+void sleep_stats_pre_sleep(TickType_t expected);
+void sleep_stats_post_sleep(TickType_t expected);
+void sleep_stats_task_switched_in(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLEEP_STATS_H__
+
+/** @} */
@@ -0,0 +1,105 @@
+/**@file
+ * @ingroup stack_usage
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(STACK_USAGE)
+#include "stack_usage.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "nrf_log.h"
+
+#if !INCLUDE_uxTaskGetStackHighWaterMark || !configRECORD_STACK_HIGH_ADDRESS
+#error "stack_usage needs INCLUDE_uxTaskGetStackHighWaterMark and configRECORD_STACK_HIGH_ADDRESS"
+#endif
+
+#define EXC_FRAME_WORDS 26      /* Exception frame with the FPU state. */
+#define ROUND_WORDS     8
+
+typedef struct
+{
+    TaskHandle_t task;
+    uint32_t     size;          /* Words. */
+    uint32_t     used;          /* Peak, in words. */
+    TickType_t   peak_at;       /* Tick count of the sample that saw the peak. */
+} task_stack_t;
+
+static task_stack_t m_tasks[STACK_USAGE_MAX_TASKS];
+
+/* Called in the critical section of the task creation and deletion. */
+void stack_usage_task_create(void * task, uint32_t size)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(m_tasks); i++)
+    {
+        if (m_tasks[i].task == NULL)
+        {
+            m_tasks[i].task    = task;
+            m_tasks[i].size    = size;
+            m_tasks[i].used    = 0;
+            m_tasks[i].peak_at = 0;
+            return;
+        }
+    }
+}
+
+void stack_usage_task_delete(void * task)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(m_tasks); i++)
+    {
+        if (m_tasks[i].task == task)
+        {
+            m_tasks[i].task = NULL;
+        }
+    }
+}
+
+static uint32_t recommended(uint32_t used)
+{
+    uint32_t size = used + MAX((used * STACK_USAGE_MARGIN_PERCENT) / 100, EXC_FRAME_WORDS);
+
+    return ALIGN_NUM(ROUND_WORDS, size);
+}
+
+void stack_usage_log(void)
+{
+    TickType_t now       = xTaskGetTickCount();
+    uint32_t   total     = 0;
+    uint32_t   total_use = 0;
+    uint32_t   total_rec = 0;
+    uint32_t   saving    = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(m_tasks); i++)
+    {
+        task_stack_t * p_stack = &m_tasks[i];
+
+        if (p_stack->task == NULL)
+        {
+            continue;
+        }
+
+        /* The high water mark only goes down, the usage is the peak. */
+        uint32_t used = p_stack->size - uxTaskGetStackHighWaterMark(p_stack->task);
+
+        if (used > p_stack->used)
+        {
+            p_stack->used    = used;
+            p_stack->peak_at = now;
+        }
+
+        uint32_t rec = recommended(p_stack->used);
+
+        NRF_LOG_INFO("stack task=%s size=%u used=%u peak_at=%us recommended=%u",
+                     NRF_LOG_PUSH(pcTaskGetName(p_stack->task)), p_stack->size, p_stack->used,
+                     p_stack->peak_at / configTICK_RATE_HZ, rec);
+
+        total     += p_stack->size;
+        total_use += p_stack->used;
+        total_rec += rec;
+        saving    += (p_stack->size > rec) ? (p_stack->size - rec) : 0;
+    }
+
+    NRF_LOG_INFO("stack total size=%u used=%u recommended=%u saving=%u",
+                 total, total_use, total_rec, saving * sizeof(StackType_t));
+}
+
+#endif // NRF_MODULE_ENABLED(STACK_USAGE)
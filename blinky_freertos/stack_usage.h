@@ -0,0 +1,55 @@
+/** @file
+ * @defgroup stack_usage Stack usage
+ * @{
+ * @ingroup blinky_example_freertos
+ *
+ * @brief Peak stack usage of every task and the stack sizes it suggests.
+ *
+ * With INCLUDE_uxTaskGetStackHighWaterMark set, FreeRTOS paints every task stack with 0xA5
+ * when the task is created; the high water mark is the part never written since. The module
+ * learns the stack size of every task created through traceTASK_CREATE, from the stack bounds
+ * kept with configRECORD_STACK_HIGH_ADDRESS, so the tasks are created as before. It samples the
+ * high water marks and logs them with every CPU load report, in words:
+ *
+ *     stack task=LED0 size=260 used=78 peak_at=5s recommended=104
+ *     stack task=IDLE size=60 used=40 peak_at=0s recommended=72
+ *     stack total size=736 used=312 recommended=456 saving=1120
+ *
+ * peak_at is the uptime of the first sample that saw the peak: a peak still moving after hours
+ * of running means the app has not been exercised enough for the numbers to be trusted.
+ * The recommended size is the peak plus @ref STACK_USAGE_MARGIN_PERCENT, at least the 26 words
+ * of an exception frame with the FPU state, which an interrupt may push at any point, rounded
+ * up to 8 words. The saving is in bytes, summed over the tasks whose stacks are too large.
+ *
+ * Tasks created beyond @ref STACK_USAGE_MAX_TASKS are not reported. Interrupts and main() run
+ * on the main stack, which is not covered.
+ */
+#ifndef STACK_USAGE_H__
+#define STACK_USAGE_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for adding a task, traceTASK_CREATE.
+ *
+ * @param[in] task Task handle.
+ * @param[in] size Stack size in words.
+ */
+void stack_usage_task_create(void * task, uint32_t size);
+
+/**@brief Function for removing a task, traceTASK_DELETE. */
+void stack_usage_task_delete(void * task);
+
+/**@brief Function for sampling the high water marks and logging the stack usage. */
+void stack_usage_log(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STACK_USAGE_H__
+
+/** @} */
@@ -0,0 +1,136 @@
+/**@file
+ * @ingroup trace_rec
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(TRACE_REC)
+#include "trace_rec.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "nrf.h"
+#include "cpu_load.h"
+
+#if !configGENERATE_RUN_TIME_STATS || !configUSE_TRACE_FACILITY
+#error "trace_rec needs configGENERATE_RUN_TIME_STATS and configUSE_TRACE_FACILITY"
+#endif
+
+STATIC_ASSERT(IS_POWER_OF_TWO(TRACE_REC_EVENTS) && (TRACE_REC_EVENTS <= 32768));
+STATIC_ASSERT(TRACE_REC_MAX_TASKS <= UINT8_MAX);
+
+#if (CPU_LOAD_TIMER_SOURCE == 0)
+#define TIME_FREQ   64000000UL
+#else
+#define TIME_FREQ   1000000UL
+#endif
+
+typedef struct
+{
+    uint32_t time;
+    uint8_t  type;
+    uint8_t  id;
+    uint16_t arg;
+} trace_rec_event_t;
+
+STATIC_ASSERT(sizeof(trace_rec_event_t) == 8);
+
+/* Layout documented in trace_rec.h, read by apps/trace/trace_convert.py. */
+typedef struct
+{
+    uint32_t          magic;
+    uint32_t          freq;
+    uint16_t          events;
+    uint8_t           tasks;
+    uint8_t           name_len;
+    volatile uint32_t count;
+    char              names[TRACE_REC_MAX_TASKS][configMAX_TASK_NAME_LEN];
+    trace_rec_event_t ring[TRACE_REC_EVENTS];
+} trace_rec_t;
+
+/* trace_convert.py finds the ring after the names, rounded up to 4 bytes. */
+STATIC_ASSERT(offsetof(trace_rec_t, ring) ==
+              ((offsetof(trace_rec_t, names) + sizeof(((trace_rec_t *)0)->names) + 3) & ~3UL));
+
+trace_rec_t trace_rec __attribute__((used)) =
+{
+    .magic    = TRACE_REC_MAGIC,
+    .freq     = TIME_FREQ,
+    .events   = TRACE_REC_EVENTS,
+    .tasks    = TRACE_REC_MAX_TASKS,
+    .name_len = configMAX_TASK_NAME_LEN,
+};
+
+/* Number of the task running, for the events recorded in tasks. */
+static uint8_t m_current;
+
+static void record(uint8_t type, uint8_t id, uint16_t arg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    trace_rec_event_t * p_event = &trace_rec.ring[trace_rec.count & (TRACE_REC_EVENTS - 1)];
+
+    p_event->time = cpu_load_timer_get();
+    p_event->type = type;
+    p_event->id   = id;
+    p_event->arg  = arg;
+    trace_rec.count++;
+
+    __set_PRIMASK(primask);
+}
+
+/* Records in the context running: the task, or the interrupt with the flag set. */
+static void record_here(uint8_t type, uint16_t arg)
+{
+    uint32_t ipsr = __get_IPSR();
+
+    if (ipsr != 0)
+    {
+        record(type | TRACE_REC_FROM_ISR, (uint8_t)ipsr, arg);
+    }
+    else
+    {
+        record(type, m_current, arg);
+    }
+}
+
+void trace_rec_task_create(uint32_t number, char const * p_name)
+{
+    if ((number >= 1) && (number <= TRACE_REC_MAX_TASKS))
+    {
+        strncpy(trace_rec.names[number - 1], p_name, configMAX_TASK_NAME_LEN);
+    }
+}
+
+void trace_rec_task_switch(uint8_t type, uint32_t number)
+{
+    if (type == TRACE_REC_TASK_IN)
+    {
+        m_current = (uint8_t)number;
+    }
+    record(type, (uint8_t)number, 0);
+}
+
+void trace_rec_queue(uint8_t type, void const * p_queue)
+{
+    record_here(type, (uint16_t)(((uint32_t)p_queue - TRACE_REC_RAM_BASE) / sizeof(uint32_t)));
+}
+
+void trace_rec_notify(uint32_t number)
+{
+    record_here(TRACE_REC_NOTIFY, (uint16_t)number);
+}
+
+void trace_rec_isr_enter(void)
+{
+    record(TRACE_REC_ISR_ENTER | TRACE_REC_FROM_ISR, (uint8_t)__get_IPSR(), 0);
+}
+
+void trace_rec_isr_exit(void)
+{
+    record(TRACE_REC_ISR_EXIT | TRACE_REC_FROM_ISR, (uint8_t)__get_IPSR(), 0);
+}
+
+#endif // NRF_MODULE_ENABLED(TRACE_REC)
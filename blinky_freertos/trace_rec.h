@@ -0,0 +1,97 @@
+/** @file
+ * @defgroup trace_rec Trace recorder
+ * @{
+ * @ingroup blinky_example_freertos
+ *
+ * @brief Scheduling events recorded in a RAM ring buffer, converted to a timeline on the host.
+ *
+ * The FreeRTOS trace macros defined in FreeRTOSConfig.h record, as 8-byte events timestamped
+ * with the run-time counter of cpu_load:
+ *
+ * - task switches in and out (traceTASK_SWITCHED_IN, traceTASK_SWITCHED_OUT), task names are
+ *   kept aside when tasks are created (traceTASK_CREATE),
+ * - queue, semaphore and mutex operations: send, receive and blocking on either,
+ * - task notifications, with the task notified.
+ *
+ * FreeRTOS has no interrupt hooks: handlers call @ref trace_rec_isr_enter and
+ * @ref trace_rec_isr_exit themselves, as the RTC2 handler of periodic_work does. Events
+ * recorded in an interrupt carry @ref TRACE_REC_FROM_ISR and the exception number instead of
+ * the task number.
+ *
+ * The ring holds the last @ref TRACE_REC_EVENTS events. apps/trace/trace_convert.py halts the
+ * CPU, reads the recorder from RAM with nrfjprog (its address from the ELF file) and writes a
+ * Chrome trace JSON file, opened with https://ui.perfetto.dev or chrome://tracing:
+ *
+ *     python apps/trace/trace_convert.py _build/nrf52840_xxaa.out trace.json
+ *
+ * Queues are named after their StaticQueue_t buffer, found by address in the ELF file.
+ *
+ * Recorder layout, the global variable trace_rec, little endian:
+ *
+ *     uint32_t magic              TRACE_REC_MAGIC
+ *     uint32_t freq               timestamp frequency in Hz
+ *     uint16_t events             ring size
+ *     uint8_t  tasks              task name entries, by task number from 1
+ *     uint8_t  name_len           size of a task name entry
+ *     uint32_t count              events recorded, the next one is at count % events
+ *     char     names[tasks][name_len]
+ *     padding                     to a multiple of 4 bytes
+ *     event    ring[events]       uint32_t time, uint8_t type, uint8_t id, uint16_t arg
+ *
+ * Every event costs about 40 cycles, with interrupts disabled while it is written.
+ */
+#ifndef TRACE_REC_H__
+#define TRACE_REC_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_REC_MAGIC     0x43455254UL    //!< "TREC".
+
+/**@brief Event types. Task number in id, or the exception number with TRACE_REC_FROM_ISR. */
+enum
+{
+    TRACE_REC_TASK_IN       = 1,    //!< Task switched in.
+    TRACE_REC_TASK_OUT      = 2,    //!< Task switched out.
+    TRACE_REC_ISR_ENTER     = 3,    //!< Interrupt handler entered.
+    TRACE_REC_ISR_EXIT      = 4,    //!< Interrupt handler left.
+    TRACE_REC_QUEUE_SEND    = 5,    //!< Item sent, semaphore or mutex given. Queue in arg.
+    TRACE_REC_QUEUE_RECEIVE = 6,    //!< Item received, semaphore or mutex taken. Queue in arg.
+    TRACE_REC_BLOCK_SEND    = 7,    //!< Task blocked sending to a full queue. Queue in arg.
+    TRACE_REC_BLOCK_RECEIVE = 8,    //!< Task blocked receiving from an empty queue. Queue in arg.
+    TRACE_REC_NOTIFY        = 9,    //!< Task notified, its number in arg.
+};
+
+#define TRACE_REC_FROM_ISR  0x80    //!< Flag of the type, event recorded in an interrupt.
+
+/* Queues are given as word offsets in RAM, the arg is 16 bits wide. */
+#define TRACE_REC_RAM_BASE  0x20000000UL
+
+/**@brief Function for keeping the name of a task created, traceTASK_CREATE. */
+void trace_rec_task_create(uint32_t number, char const * p_name);
+
+/**@brief Function for recording a task switch, traceTASK_SWITCHED_IN and _OUT. */
+void trace_rec_task_switch(uint8_t type, uint32_t number);
+
+/**@brief Function for recording a queue operation, from a task or an interrupt. */
+void trace_rec_queue(uint8_t type, void const * p_queue);
+
+/**@brief Function for recording a task notification, from a task or an interrupt. */
+void trace_rec_notify(uint32_t number);
+
+/**@brief Function for recording the entry in an interrupt handler. */
+void trace_rec_isr_enter(void);
+
+/**@brief Function for recording the exit from an interrupt handler. */
+void trace_rec_isr_exit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_REC_H__
+
+/** @} */
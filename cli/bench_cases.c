@@ -0,0 +1,96 @@
+/** @file
+ * @ingroup CLI_example
+ *
+ * @brief Benchmarks of the SDK independent modules of the example, see common/bench/bench.h.
+ *
+ * Run on the dongle with the `bench` command, on the host with the bench target of
+ * common/host/Makefile.
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BENCH)
+#include "bench.h"
+
+#include "lzss.h"
+#include "timestamp_ext.h"
+
+#define LZSS_BLOCK_SIZE 256
+
+/* Timestamp extension updated every 1000 cycles, with 10 ms of sleep every 256 updates. */
+static timestamp_ext_t m_ext;
+static uint64_t        m_time;
+static uint32_t        m_cyc;
+static uint32_t        m_updates;
+
+static void bench_timestamp_ext_update(void * p_ctx)
+{
+    UNUSED_PARAMETER(p_ctx);
+
+    if (m_updates++ == 0)
+    {
+        timestamp_ext_init(&m_ext, 64000000, 16384, 24, 0, 0, 0);
+    }
+    if ((m_updates & 0xFF) == 0)
+    {
+        m_time += 640000;
+    }
+    m_time += 1000;
+    m_cyc  += 1000;
+    timestamp_ext_update(&m_ext, (uint32_t)((m_time * 16384) / 64000000), m_cyc);
+}
+
+BENCH_DEF(timestamp_ext_update, bench_timestamp_ext_update, NULL, 8);
+
+/* Log store block: repetitive text, as written by log_backend_store.c. */
+static uint8_t m_lzss_src[LZSS_BLOCK_SIZE];
+static uint8_t m_lzss_dst[LZSS_BOUND(LZSS_BLOCK_SIZE)];
+static size_t  m_lzss_len;
+
+static void lzss_block_fill(void)
+{
+    static char const * const lines[] =
+    {
+        "<info> app: usb event: resume\r\n",
+        "<info> cli: counter = 42\r\n",
+        "<warning> app: queue 3 of 4 full\r\n",
+    };
+    size_t len = 0;
+
+    for (size_t i = 0; len < LZSS_BLOCK_SIZE; i++)
+    {
+        char const * p_line = lines[i % ARRAY_SIZE(lines)];
+        size_t       n      = MIN(strlen(p_line), LZSS_BLOCK_SIZE - len);
+
+        memcpy(&m_lzss_src[len], p_line, n);
+        len += n;
+    }
+}
+
+static void bench_lzss_compress(void * p_ctx)
+{
+    UNUSED_PARAMETER(p_ctx);
+
+    if (m_lzss_src[0] == 0)
+    {
+        lzss_block_fill();
+    }
+    m_lzss_len = lzss_compress(m_lzss_src, LZSS_BLOCK_SIZE, m_lzss_dst, sizeof(m_lzss_dst));
+}
+
+BENCH_DEF(lzss_compress, bench_lzss_compress, NULL, 1);
+
+static void bench_lzss_decompress(void * p_ctx)
+{
+    static uint8_t out[LZSS_BLOCK_SIZE];
+
+    UNUSED_PARAMETER(p_ctx);
+
+    if (m_lzss_len == 0)
+    {
+        bench_lzss_compress(NULL);
+    }
+    UNUSED_RETURN_VALUE(lzss_decompress(m_lzss_dst, m_lzss_len, out, sizeof(out)));
+}
+
+BENCH_DEF(lzss_decompress, bench_lzss_decompress, NULL, 1);
+
+#endif // NRF_MODULE_ENABLED(BENCH)
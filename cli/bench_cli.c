@@ -0,0 +1,230 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BENCH)
+#include "bench.h"
+
+#include <string.h>
+
+#include "app_error.h"
+#include "nrf_cli.h"
+#include "coop_sched.h"
+
+#define LINE_SIZE       192
+#define FILTER_SIZE     32
+
+/* Line executed by the cli_dispatch benchmark, ended by the new line character of its instance. */
+#define DISPATCH_LINE   "bench nop\n"
+
+/* Transport of the cli_dispatch instance: every nrf_cli_process() call reads DISPATCH_LINE once,
+   what nrf_cli writes (echo, prompt) is dropped. */
+static size_t m_dispatch_pos;
+
+static ret_code_t dispatch_init(nrf_cli_transport_t const * p_transport,
+                                void const *                p_config,
+                                nrf_cli_transport_handler_t evt_handler,
+                                void *                      p_context)
+{
+    UNUSED_PARAMETER(p_transport);
+    UNUSED_PARAMETER(p_config);
+    UNUSED_PARAMETER(evt_handler);
+    UNUSED_PARAMETER(p_context);
+    return NRF_SUCCESS;
+}
+
+static ret_code_t dispatch_uninit(nrf_cli_transport_t const * p_transport)
+{
+    UNUSED_PARAMETER(p_transport);
+    return NRF_SUCCESS;
+}
+
+static ret_code_t dispatch_enable(nrf_cli_transport_t const * p_transport, bool blocking)
+{
+    UNUSED_PARAMETER(p_transport);
+    UNUSED_PARAMETER(blocking);
+    return NRF_SUCCESS;
+}
+
+static ret_code_t dispatch_write(nrf_cli_transport_t const * p_transport,
+                                 void const *                p_data,
+                                 size_t                      length,
+                                 size_t *                    p_cnt)
+{
+    UNUSED_PARAMETER(p_transport);
+    UNUSED_PARAMETER(p_data);
+    *p_cnt = length;
+    return NRF_SUCCESS;
+}
+
+static ret_code_t dispatch_read(nrf_cli_transport_t const * p_transport,
+                                void *                      p_data,
+                                size_t                      length,
+                                size_t *                    p_cnt)
+{
+    size_t cnt = MIN(length, sizeof(DISPATCH_LINE) - 1 - m_dispatch_pos);
+
+    UNUSED_PARAMETER(p_transport);
+    memcpy(p_data, &DISPATCH_LINE[m_dispatch_pos], cnt);
+    /* The empty read ending a process call rewinds the line for the next one. */
+    m_dispatch_pos = (cnt != 0) ? (m_dispatch_pos + cnt) : 0;
+    *p_cnt = cnt;
+    return NRF_SUCCESS;
+}
+
+static const nrf_cli_transport_api_t m_dispatch_transport_api =
+{
+    .init   = dispatch_init,
+    .uninit = dispatch_uninit,
+    .enable = dispatch_enable,
+    .write  = dispatch_write,
+    .read   = dispatch_read,
+};
+
+static const nrf_cli_transport_t m_dispatch_transport = { .p_api = &m_dispatch_transport_api };
+
+NRF_CLI_DEF(m_dispatch_cli, "", &m_dispatch_transport, '\n', 1);
+
+static bool m_dispatch_started;
+
+/* A command line through nrf_cli, from the transport read to the handler of 'bench nop', with
+   the echo and the prompt, as on a console. The instance is started by the first warm-up call. */
+static void bench_cli_dispatch(void * p_ctx)
+{
+    UNUSED_PARAMETER(p_ctx);
+
+    if (!m_dispatch_started)
+    {
+        APP_ERROR_CHECK(nrf_cli_init(&m_dispatch_cli, NULL, false, false, NRF_LOG_SEVERITY_NONE));
+        APP_ERROR_CHECK(nrf_cli_start(&m_dispatch_cli));
+        m_dispatch_started = true;
+    }
+    nrf_cli_process(&m_dispatch_cli);
+}
+
+BENCH_DEF(cli_dispatch, bench_cli_dispatch, NULL, 1);
+
+/* Run in progress. A benchmark takes up to hundreds of ms with interrupts masked during every
+   sample, so one benchmark is run per scheduler step and the consoles are serviced in between. */
+static struct
+{
+    nrf_cli_t const * p_cli;
+    char              filter[FILTER_SIZE];  //!< Empty for all of them.
+    size_t            idx;
+    size_t            cnt;
+    bool              busy;
+} m_run;
+
+static bool run_step(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    for (; m_run.idx < bench_count(); m_run.idx++)
+    {
+        bench_case_t const * p_case = bench_get(m_run.idx);
+        bench_result_t       result;
+        char                 line[LINE_SIZE];
+
+        if ((m_run.filter[0] != '\0') && strcmp(m_run.filter, p_case->p_name))
+        {
+            continue;
+        }
+
+        bench_run(p_case, &result);
+        (void)bench_format(line, sizeof(line), p_case, &result);
+        nrf_cli_print(m_run.p_cli, "%s", line);
+
+        m_run.idx++;
+        m_run.cnt++;
+        return true;
+    }
+
+    if (m_run.cnt == 0)
+    {
+        nrf_cli_error(m_run.p_cli, "bench run: unknown benchmark: %s", m_run.filter);
+    }
+    m_run.busy = false;
+    return false;
+}
+
+static void cmd_bench_run(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc > 2)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    if (m_run.busy)
+    {
+        nrf_cli_error(p_cli, "%s: already running", argv[0]);
+        return;
+    }
+
+    char const * p_filter = (argc == 2) ? argv[1] : "";
+
+    if (strlen(p_filter) >= sizeof(m_run.filter))
+    {
+        nrf_cli_error(p_cli, "%s: unknown benchmark: %s", argv[0], p_filter);
+        return;
+    }
+
+    /* argv does not outlive the handler. */
+    strcpy(m_run.filter, p_filter);
+    m_run.p_cli = p_cli;
+    m_run.idx   = 0;
+    m_run.cnt   = 0;
+
+    if (coop_sched_defer(run_step, NULL) != NRF_SUCCESS)
+    {
+        nrf_cli_error(p_cli, "%s: scheduler queue full, try again", argv[0]);
+        return;
+    }
+    m_run.busy = true;
+}
+
+static void cmd_bench_nop(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+    }
+}
+
+static void cmd_bench(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+        return;
+    }
+
+    for (size_t i = 0; i < bench_count(); i++)
+    {
+        bench_case_t const * p_case = bench_get(i);
+
+        nrf_cli_print(p_cli, "%-24s batch %u", p_case->p_name, p_case->batch);
+    }
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_bench)
+{
+    NRF_CLI_CMD(nop, NULL, "Do nothing, the command of the cli_dispatch benchmark", cmd_bench_nop),
+    NRF_CLI_CMD(run, NULL, "Run all benchmarks or the given one: run [name]", cmd_bench_run),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(bench, &m_sub_bench, "List the micro-benchmarks", cmd_bench);
+
+#endif // NRF_MODULE_ENABLED(BENCH)
@@ -0,0 +1,289 @@
+/* Host test of the CLI batch engine and of the batch transport.
+ *
+ * Build and run on the host:
+ *   gcc -O2 -I../common/host -Iconfig -o cli_batch-test cli_batch-test.c cli_batch.c \
+ *     cli_batch_transport.c ../common/host/nrf_cli.c ../common/host/coop_sched_host.c && ./cli_batch-test
+ *
+ * A fake transport delivers a generated script in USB full speed packet sized chunks, the
+ * commands are dispatched against a small command table and the execution rate is reported.
+ * The batch transport is then driven as on the target: a fake inner transport is read by the
+ * nrf_cli shim of common/host, the batch commands are dispatched by it and the captured lines
+ * are executed by deferred work.
+ */
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cli_batch.h"
+#include "cli_batch_transport.h"
+#include "coop_sched.h"
+
+#define TEST_BUFFER_SIZE  (1024u * 1024u)
+#define TEST_PACKET_SIZE  64u   /* NRFX_USBD_EPSIZE */
+#define TEST_CMD_COUNT    20000u
+
+static char        m_script[TEST_BUFFER_SIZE];
+static size_t      m_script_len;
+static unsigned    m_handled[3];
+static unsigned    m_fails;
+
+CLI_BATCH_DEF(m_batch, TEST_BUFFER_SIZE);
+
+static char const * const m_cmd_names[] = { "counter", "print", "dynamic" };
+
+static bool test_exec(void * p_context, size_t argc, char ** argv)
+{
+    (void)p_context;
+    for (size_t i = 0; i < sizeof(m_cmd_names) / sizeof(m_cmd_names[0]); i++)
+    {
+        if (!strcmp(argv[0], m_cmd_names[i]))
+        {
+            m_handled[i] += (unsigned)argc;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void check(bool cond, char const * p_what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", p_what);
+        m_fails++;
+    }
+}
+
+/* Fake transport: hands the script over in packets, as the CDC ACM class would. */
+static void transport_send(char const * p_data, size_t len)
+{
+    while (len > 0)
+    {
+        size_t chunk    = (len < TEST_PACKET_SIZE) ? len : TEST_PACKET_SIZE;
+        size_t consumed = cli_batch_feed(&m_batch, p_data, chunk);
+        p_data += consumed;
+        len    -= consumed;
+        if (consumed < chunk)
+        {
+            break;
+        }
+    }
+}
+
+static void script_add(char const * p_line)
+{
+    m_script_len += (size_t)sprintf(&m_script[m_script_len], "%s\r\n", p_line);
+}
+
+static void test_parsing(void)
+{
+    static char const script[] =
+        "# comment\r\n"
+        "\r\n"
+        "   counter start  \r\n"
+        "print all \"a b\" c\n"
+        "unknown\r\n"
+        "batch end\r\n"
+        "print param\r\n";
+
+    memset(m_handled, 0, sizeof(m_handled));
+    cli_batch_begin(&m_batch);
+    size_t consumed = cli_batch_feed(&m_batch, script, sizeof(script) - 1);
+    check(m_batch.state == CLI_BATCH_STATE_READY, "end line stops the capture");
+    consumed += strspn(&script[consumed], "\r\n");
+    check(strcmp(&script[consumed], "print param\r\n") == 0, "bytes after end line not consumed");
+
+    while (cli_batch_step(&m_batch, test_exec, NULL)) { }
+
+    check(m_batch.status.lines == 3, "comments and empty lines skipped");
+    check(m_batch.status.executed == 2, "known commands executed");
+    check(m_batch.status.unknown == 1, "unknown command counted");
+    check(m_handled[0] == 2, "counter start tokenized");
+    check(m_handled[1] == 4, "quoted token kept together");
+}
+
+static void test_overflow(void)
+{
+    static char small_buf[32];
+    cli_batch_t small = { .p_buf = small_buf, .size = sizeof(small_buf) };
+
+    cli_batch_begin(&small);
+    (void)cli_batch_feed(&small, "counter start\r\n", 15);
+    (void)cli_batch_feed(&small, "counter stop with a very long tail\r\n", 36);
+    (void)cli_batch_feed(&small, "batch end\r\n", 11);
+    check(small.state == CLI_BATCH_STATE_READY, "end line found after overflow");
+    check(small.status.overflow, "overflow reported");
+    check(small.status.lines == 1, "truncated line dropped");
+}
+
+static void test_rate(void)
+{
+    char const * const lines[] = { "counter start", "print param a b c", "dynamic show" };
+
+    m_script_len = 0;
+    for (unsigned i = 0; i < TEST_CMD_COUNT; i++)
+    {
+        script_add(lines[i % 3]);
+    }
+    script_add(CLI_BATCH_END_LINE);
+
+    memset(m_handled, 0, sizeof(m_handled));
+    clock_t start = clock();
+
+    cli_batch_begin(&m_batch);
+    transport_send(m_script, m_script_len);
+    while (cli_batch_step(&m_batch, test_exec, NULL)) { }
+
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    check(m_batch.status.executed == TEST_CMD_COUNT, "all commands executed");
+    printf("%u commands, %zu bytes in %.3f ms: %.0f commands/s\r\n",
+           (unsigned)m_batch.status.executed,
+           m_script_len,
+           elapsed * 1000.0,
+           (elapsed > 0.0) ? m_batch.status.executed / elapsed : 0.0);
+}
+
+/* Inner transport: hands out the bytes of m_rx. */
+typedef struct
+{
+    nrf_cli_transport_t transport;
+    char const *        p_rx;
+    size_t              rx_len;
+} test_transport_t;
+
+static ret_code_t test_transport_read(nrf_cli_transport_t const * p_transport,
+                                      void *                      p_data,
+                                      size_t                      length,
+                                      size_t *                    p_cnt)
+{
+    test_transport_t * p_tt = (test_transport_t *)p_transport;
+
+    *p_cnt = (length < p_tt->rx_len) ? length : p_tt->rx_len;
+    memcpy(p_data, p_tt->p_rx, *p_cnt);
+    p_tt->p_rx   += *p_cnt;
+    p_tt->rx_len -= *p_cnt;
+    return NRF_SUCCESS;
+}
+
+static const nrf_cli_transport_api_t m_test_transport_api = { .read = test_transport_read };
+
+static test_transport_t m_inner = { .transport = { .p_api = &m_test_transport_api } };
+
+CLI_BATCH_TRANSPORT_DEF(m_batch_transport, &m_inner.transport, 256);
+NRF_CLI_DEF(m_cli, "test:~$ ", &m_batch_transport.transport, '\n', 0);
+/* A console without batch mode, like RTT. */
+NRF_CLI_DEF(m_cli_plain, "plain:~$ ", &nrf_cli_host_transport, '\n', 0);
+
+static unsigned m_count_calls;
+static unsigned m_add_calls;
+
+static void cmd_tcount(nrf_cli_t const * p_cli, size_t argc, char ** argv)
+{
+    UNUSED_PARAMETER(p_cli);
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+
+    m_count_calls++;
+}
+
+static void cmd_tgroup_add(nrf_cli_t const * p_cli, size_t argc, char ** argv)
+{
+    UNUSED_PARAMETER(p_cli);
+    UNUSED_PARAMETER(argv);
+
+    m_add_calls += (unsigned)argc;
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_tgroup)
+{
+    NRF_CLI_CMD(add, NULL, "Count the arguments.", cmd_tgroup_add),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(tcount, NULL, "Count the calls.", cmd_tcount);
+NRF_CLI_CMD_REGISTER(tgroup, &m_sub_tgroup, "Group without a handler.", NULL);
+
+/* Feeds the bytes to the console as received, runs the deferred work. Returns the number of
+   errors printed. */
+static uint32_t console_rx(char const * p_rx)
+{
+    uint32_t errors = m_cli.p_ctx->errors;
+
+    m_inner.p_rx   = p_rx;
+    m_inner.rx_len = strlen(p_rx);
+    nrf_cli_process(&m_cli);
+    coop_sched_run();
+    return m_cli.p_ctx->errors - errors;
+}
+
+static uint32_t plain_execute(char const * p_line)
+{
+    char     line[64];
+    uint32_t errors = m_cli_plain.p_ctx->errors;
+
+    snprintf(line, sizeof(line), "%s", p_line);
+    check(nrf_cli_host_execute(&m_cli_plain, line), "command found");
+    return m_cli_plain.p_ctx->errors - errors;
+}
+
+static void test_transport(void)
+{
+    cli_batch_status_t const * p_status = &m_batch_transport.p_batch->status;
+
+    m_count_calls = 0;
+    m_add_calls   = 0;
+    check(console_rx("batch begin\r\n"
+                     "tcount\r\n"
+                     "# comment\r\n"
+                     "tgroup add 1 2\r\n"
+                     "nope\r\n"
+                     "tcount -h\r\n"
+                     "tgroup --help\r\n"
+                     "batch end\r\n"
+                     "tcount\r\n") == 0, "batch through the transport");
+    check(p_status->lines == 5, "captured lines");
+    check(p_status->executed == 4, "executed lines, help included");
+    check(p_status->unknown == 1, "unknown line");
+    check(m_count_calls == 2, "batch line and the line after the end line executed");
+    check(m_add_calls == 3, "subcommand executed with its arguments");
+    check(m_batch_transport.p_batch->state == CLI_BATCH_STATE_IDLE, "batch finished");
+}
+
+static void test_transport_cmds(void)
+{
+    check(console_rx("batch\r\n") == 0, "batch prints the help");
+    check(console_rx("batch -h\r\n") == 0, "batch -h");
+    check(console_rx("batch --help\r\n") == 0, "batch --help");
+    check(console_rx("batch begin -h\r\n") == 0, "batch begin -h");
+    check(console_rx("batch end --help\r\n") == 0, "batch end --help");
+    check(console_rx("batch abort -h\r\n") == 0, "batch abort -h");
+    check(m_batch_transport.p_batch->state == CLI_BATCH_STATE_IDLE, "help starts nothing");
+
+    check(console_rx("batch end\r\n") == 0, "batch end without a batch is a warning");
+    check(console_rx("batch abort\r\n") == 0, "batch abort without a batch is a warning");
+    check(console_rx("batch end x\r\n") == 1, "batch end with a parameter");
+    check(console_rx("batch abort x\r\n") == 1, "batch abort with a parameter");
+    check(console_rx("batch x\r\n") == 1, "unknown batch parameter");
+
+    /* The abort line follows the end line, it is read before the deferred work runs. */
+    m_count_calls = 0;
+    check(console_rx("batch begin\r\ntcount\r\nbatch end\r\nbatch abort\r\n") == 0, "abort");
+    check(m_count_calls == 0, "aborted batch not executed");
+    check(m_batch_transport.p_batch->state == CLI_BATCH_STATE_IDLE, "aborted batch idle");
+
+    check(plain_execute("batch begin") == 1, "batch begin without batch mode");
+    check(plain_execute("batch abort") == 1, "batch abort without batch mode");
+    check(plain_execute("batch -h") == 0, "help without batch mode");
+}
+
+int main(void)
+{
+    printf("------------- Testing CLI batch engine ---------------\r\n");
+    test_parsing();
+    test_overflow();
+    test_rate();
+    test_transport();
+    test_transport_cmds();
+    printf("%s\r\n", m_fails ? "FAILED" : "PASSED");
+    return m_fails ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+#include "cli_batch.h"
+
+#include <string.h>
+
+static bool is_blank(char c)
+{
+    return (c == ' ') || (c == '\t');
+}
+
+/* Strips leading and trailing blanks of the line [start, end) in place.
+   Returns the new start offset and updates end. */
+static size_t line_trim(char * p_buf, size_t start, size_t * p_end)
+{
+    while ((start < *p_end) && is_blank(p_buf[start]))
+    {
+        start++;
+    }
+    while ((*p_end > start) && is_blank(p_buf[*p_end - 1]))
+    {
+        (*p_end)--;
+    }
+    return start;
+}
+
+/* Called on every line terminator. Keeps the line (terminated with '\0') or drops it. */
+static void line_complete(cli_batch_t * p_batch)
+{
+    size_t end   = p_batch->len;
+    size_t start = line_trim(p_batch->p_buf, p_batch->line_start, &end);
+    size_t n     = end - start;
+
+    if ((n == sizeof(CLI_BATCH_END_LINE) - 1) &&
+        (memcmp(&p_batch->p_buf[start], CLI_BATCH_END_LINE, n) == 0))
+    {
+        p_batch->len   = p_batch->line_start;
+        p_batch->state = CLI_BATCH_STATE_READY;
+        return;
+    }
+
+    if ((n == 0) || (p_batch->p_buf[start] == '#'))
+    {
+        p_batch->len = p_batch->line_start;
+        return;
+    }
+
+    /* Always leave room for the end line, otherwise the capture could never be stopped. */
+    if ((p_batch->size - (p_batch->line_start + n + 1)) < sizeof(CLI_BATCH_END_LINE))
+    {
+        p_batch->status.overflow = true;
+        p_batch->len = p_batch->line_start;
+        return;
+    }
+
+    memmove(&p_batch->p_buf[p_batch->line_start], &p_batch->p_buf[start], n);
+    p_batch->len = p_batch->line_start + n;
+    p_batch->p_buf[p_batch->len++] = '\0';
+    p_batch->line_start = p_batch->len;
+    p_batch->status.lines++;
+}
+
+void cli_batch_begin(cli_batch_t * p_batch)
+{
+    p_batch->len          = 0;
+    p_batch->line_start   = 0;
+    p_batch->exec_pos     = 0;
+    p_batch->line_dropped = false;
+    memset(&p_batch->status, 0, sizeof(p_batch->status));
+    p_batch->state        = CLI_BATCH_STATE_CAPTURING;
+}
+
+size_t cli_batch_feed(cli_batch_t * p_batch, char const * p_data, size_t len)
+{
+    size_t i;
+
+    for (i = 0; (i < len) && (p_batch->state == CLI_BATCH_STATE_CAPTURING); i++)
+    {
+        char c = p_data[i];
+
+        if ((c == '\r') || (c == '\n'))
+        {
+            if (p_batch->line_dropped)
+            {
+                p_batch->line_dropped = false;
+            }
+            else
+            {
+                line_complete(p_batch);
+            }
+        }
+        else if (p_batch->line_dropped)
+        {
+            continue;
+        }
+        else if (p_batch->len < (p_batch->size - 1))
+        {
+            p_batch->p_buf[p_batch->len++] = c;
+        }
+        else
+        {
+            /* Keep capturing to find the end line, but drop the rest of this line. */
+            p_batch->status.overflow = true;
+            p_batch->line_dropped    = true;
+            p_batch->len             = p_batch->line_start;
+        }
+    }
+
+    return i;
+}
+
+/* Splits the line in place. Double quotes group blanks into one token. */
+static size_t line_tokenize(char * p_line, char ** argv, size_t argv_size)
+{
+    size_t argc = 0;
+    char * p_rd = p_line;
+
+    while (*p_rd != '\0')
+    {
+        while (is_blank(*p_rd))
+        {
+            p_rd++;
+        }
+        if (*p_rd == '\0')
+        {
+            break;
+        }
+        if (argc == argv_size)
+        {
+            return argv_size + 1;
+        }
+
+        char * p_wr  = p_rd;
+        bool   quote = false;
+
+        argv[argc++] = p_wr;
+        while ((*p_rd != '\0') && (quote || !is_blank(*p_rd)))
+        {
+            if (*p_rd == '"')
+            {
+                quote = !quote;
+            }
+            else
+            {
+                *p_wr++ = *p_rd;
+            }
+            p_rd++;
+        }
+        if (*p_rd != '\0')
+        {
+            p_rd++;
+        }
+        *p_wr = '\0';
+    }
+
+    return argc;
+}
+
+bool cli_batch_step(cli_batch_t * p_batch, cli_batch_exec_t exec, void * p_context)
+{
+    if ((p_batch->state != CLI_BATCH_STATE_READY) || (p_batch->exec_pos >= p_batch->len))
+    {
+        p_batch->state = CLI_BATCH_STATE_IDLE;
+        return false;
+    }
+
+    char * p_line = &p_batch->p_buf[p_batch->exec_pos];
+    char * argv[CLI_BATCH_ARGC_MAX];
+
+    p_batch->exec_pos += strlen(p_line) + 1;
+
+    size_t argc = line_tokenize(p_line, argv, CLI_BATCH_ARGC_MAX);
+    if ((argc == 0) || (argc > CLI_BATCH_ARGC_MAX))
+    {
+        p_batch->status.errors++;
+    }
+    else if (exec(p_context, argc, argv))
+    {
+        p_batch->status.executed++;
+    }
+    else
+    {
+        p_batch->status.unknown++;
+    }
+
+    if (p_batch->exec_pos >= p_batch->len)
+    {
+        p_batch->state = CLI_BATCH_STATE_IDLE;
+        return false;
+    }
+    return true;
+}
+
+void cli_batch_abort(cli_batch_t * p_batch)
+{
+    p_batch->state = CLI_BATCH_STATE_IDLE;
+}
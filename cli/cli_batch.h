@@ -0,0 +1,124 @@
+/** @file
+ * @defgroup cli_batch CLI batch engine
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Buffers a script of CLI commands and executes it line by line.
+ *
+ * While capturing, raw bytes are appended to the buffer and split into lines; no echo, VT100
+ * redraw or history handling takes place. A line equal to @ref CLI_BATCH_END_LINE stops the
+ * capture. Empty lines and lines starting with '#' are ignored. Each line is then tokenized in
+ * place and passed to an execute callback, one line per @ref cli_batch_step call, so execution
+ * can be spread over several main loop iterations.
+ *
+ * The engine has no SDK dependencies and is built on the host by cli_batch-test.c.
+ */
+#ifndef CLI_BATCH_H__
+#define CLI_BATCH_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CLI_BATCH_END_LINE "batch end" /**< Line terminating the capture. */
+#define CLI_BATCH_ARGC_MAX 12          /**< Maximum number of tokens in a line. */
+
+/**@brief Command execute callback.
+ *
+ * @param[in] p_context Context given to @ref cli_batch_step.
+ * @param[in] argc      Number of tokens.
+ * @param[in] argv      Tokens.
+ *
+ * @retval true  Command found and executed.
+ * @retval false Unknown command.
+ */
+typedef bool (*cli_batch_exec_t)(void * p_context, size_t argc, char ** argv);
+
+/**@brief Batch state. */
+typedef enum
+{
+    CLI_BATCH_STATE_IDLE,      //!< Nothing captured.
+    CLI_BATCH_STATE_CAPTURING, //!< Appending received bytes to the buffer.
+    CLI_BATCH_STATE_READY,     //!< End line received, lines can be executed.
+} cli_batch_state_t;
+
+/**@brief Aggregate status of a batch. */
+typedef struct
+{
+    uint32_t lines;    //!< Number of command lines captured.
+    uint32_t executed; //!< Number of commands executed.
+    uint32_t unknown;  //!< Number of lines not matching any command.
+    uint32_t errors;   //!< Number of lines that could not be parsed (e.g. too many tokens).
+    bool     overflow; //!< Script did not fit in the buffer and was truncated.
+} cli_batch_status_t;
+
+/**@brief Batch instance. Use @ref CLI_BATCH_DEF to create one. */
+typedef struct
+{
+    char *             p_buf;        //!< Line buffer.
+    size_t             size;         //!< Buffer size.
+    size_t             len;          //!< Bytes stored in the buffer.
+    size_t             line_start;   //!< Start of the line currently being received.
+    size_t             exec_pos;     //!< Start of the next line to execute.
+    bool               line_dropped; //!< Line currently being received did not fit.
+    cli_batch_state_t  state;        //!< Current state.
+    cli_batch_status_t status;       //!< Aggregate status.
+} cli_batch_t;
+
+/**@brief Macro for defining a batch instance.
+ *
+ * @param _name Instance name.
+ * @param _size Buffer size in bytes.
+ */
+#define CLI_BATCH_DEF(_name, _size)               \
+    static char _name##_buf[_size];               \
+    static cli_batch_t _name =                    \
+    {                                             \
+        .p_buf = _name##_buf,                     \
+        .size  = (_size),                         \
+    }
+
+/**@brief Function for starting a capture. Discards any previous script. */
+void cli_batch_begin(cli_batch_t * p_batch);
+
+/**@brief Function for appending received bytes.
+ *
+ * @param[in] p_batch Batch instance.
+ * @param[in] p_data  Received bytes.
+ * @param[in] len     Number of bytes.
+ *
+ * @return Number of bytes consumed. Bytes following the end line are not consumed.
+ */
+size_t cli_batch_feed(cli_batch_t * p_batch, char const * p_data, size_t len);
+
+/**@brief Function for executing the next captured line.
+ *
+ * @param[in] p_batch   Batch instance.
+ * @param[in] exec      Execute callback.
+ * @param[in] p_context Callback context.
+ *
+ * @retval true  More lines are waiting.
+ * @retval false Batch finished, the instance returns to idle.
+ */
+bool cli_batch_step(cli_batch_t * p_batch, cli_batch_exec_t exec, void * p_context);
+
+/**@brief Function for aborting a capture or execution. */
+void cli_batch_abort(cli_batch_t * p_batch);
+
+/**@brief Function for checking if the instance is capturing input. */
+static inline bool cli_batch_is_capturing(cli_batch_t const * p_batch)
+{
+    return p_batch->state == CLI_BATCH_STATE_CAPTURING;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CLI_BATCH_H__
+
+/** @} */
@@ -0,0 +1,320 @@
+#include "sdk_common.h"
+#include "cli_batch_transport.h"
+
+#include "nrf.h"
+#include "nrf_section.h"
+#include "coop_sched.h"
+
+NRF_SECTION_DEF(cli_command, nrf_cli_cmd_entry_t);
+
+static ret_code_t batch_init(nrf_cli_transport_t const * p_transport,
+                             void const *                p_config,
+                             nrf_cli_transport_handler_t evt_handler,
+                             void *                      p_context)
+{
+    cli_batch_transport_t const * p_bt = (cli_batch_transport_t const *)p_transport;
+
+    return p_bt->p_inner->p_api->init(p_bt->p_inner, p_config, evt_handler, p_context);
+}
+
+static ret_code_t batch_uninit(nrf_cli_transport_t const * p_transport)
+{
+    cli_batch_transport_t const * p_bt = (cli_batch_transport_t const *)p_transport;
+
+    return p_bt->p_inner->p_api->uninit(p_bt->p_inner);
+}
+
+static ret_code_t batch_enable(nrf_cli_transport_t const * p_transport, bool blocking)
+{
+    cli_batch_transport_t const * p_bt = (cli_batch_transport_t const *)p_transport;
+
+    return p_bt->p_inner->p_api->enable(p_bt->p_inner, blocking);
+}
+
+static ret_code_t batch_write(nrf_cli_transport_t const * p_transport,
+                              void const *                p_data,
+                              size_t                      length,
+                              size_t *                    p_cnt)
+{
+    cli_batch_transport_t const * p_bt = (cli_batch_transport_t const *)p_transport;
+
+    return p_bt->p_inner->p_api->write(p_bt->p_inner, p_data, length, p_cnt);
+}
+
+/* Looks up a subcommand of the given set. Dynamic sets are resolved into p_entry. */
+static bool subcmd_find(nrf_cli_cmd_entry_t const * p_set,
+                        char const *                p_syntax,
+                        nrf_cli_static_entry_t *    p_entry)
+{
+    for (size_t idx = 0; ; idx++)
+    {
+        if (p_set->is_dynamic)
+        {
+            p_set->u.p_dynamic_get(idx, p_entry);
+        }
+        else
+        {
+            *p_entry = p_set->u.p_static[idx];
+        }
+
+        if (p_entry->p_syntax == NULL)
+        {
+            return false;
+        }
+        if (!strcmp(p_entry->p_syntax, p_syntax))
+        {
+            return true;
+        }
+    }
+}
+
+/* Resolves the command the same way nrf_cli does: the deepest matching (sub)command with
+   a handler is called with the arguments following it. nrf_cli_help_requested() reflects the
+   line that started the batch, so a line asking for help prints the help of the command instead
+   of calling its handler. */
+static bool batch_exec(void * p_context, size_t argc, char ** argv)
+{
+    nrf_cli_t const *      p_cli = (nrf_cli_t const *)p_context;
+    nrf_cli_static_entry_t entry = { .p_syntax = NULL };
+
+    for (size_t i = 0; i < NRF_SECTION_ITEM_COUNT(cli_command, nrf_cli_cmd_entry_t); i++)
+    {
+        nrf_cli_cmd_entry_t const * p_cmd =
+            NRF_SECTION_ITEM_GET(cli_command, nrf_cli_cmd_entry_t, i);
+
+        if (!strcmp(p_cmd->u.p_static->p_syntax, argv[0]))
+        {
+            entry = *p_cmd->u.p_static;
+            break;
+        }
+    }
+    if (entry.p_syntax == NULL)
+    {
+        return false;
+    }
+
+    nrf_cli_static_entry_t active = entry;
+    size_t                 lvl    = 0;
+
+    for (size_t i = 1; (i < argc) && (entry.p_subcmd != NULL); i++)
+    {
+        if (!subcmd_find(entry.p_subcmd, argv[i], &entry))
+        {
+            break;
+        }
+        if (entry.handler != NULL)
+        {
+            active = entry;
+            lvl    = i;
+        }
+    }
+
+    for (size_t i = lvl + 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+        {
+            nrf_cli_print(p_cli, "%s - %s", active.p_syntax, active.p_help ? active.p_help : "");
+            return true;
+        }
+    }
+
+    if (active.handler == NULL)
+    {
+        return false;
+    }
+
+    active.handler(p_cli, argc - lvl, &argv[lvl]);
+    return true;
+}
+
+static bool batch_work(void * p_context)
+{
+    cli_batch_transport_t * p_bt = (cli_batch_transport_t *)p_context;
+
+    if (cli_batch_step(p_bt->p_batch, batch_exec, (void *)p_bt->p_cli))
+    {
+        return true;
+    }
+
+    cli_batch_status_t const * p_status = &p_bt->p_batch->status;
+    uint32_t cycles = DWT->CYCCNT - p_bt->start;
+    uint32_t rate   = (cycles != 0) ?
+                      (uint32_t)(((uint64_t)p_status->executed * SystemCoreClock) / cycles) : 0;
+
+    nrf_cli_print(p_bt->p_cli,
+                  "batch: %u lines, %u executed, %u unknown, %u errors%s, %u cycles (%u cmd/s)",
+                  p_status->lines,
+                  p_status->executed,
+                  p_status->unknown,
+                  p_status->errors,
+                  p_status->overflow ? ", buffer overflow" : "",
+                  cycles,
+                  rate);
+    return false;
+}
+
+static ret_code_t batch_read(nrf_cli_transport_t const * p_transport,
+                             void *                      p_data,
+                             size_t                      length,
+                             size_t *                    p_cnt)
+{
+    cli_batch_transport_t * p_bt = (cli_batch_transport_t *)p_transport;
+    ret_code_t              ret;
+
+    if (!cli_batch_is_capturing(p_bt->p_batch))
+    {
+        return p_bt->p_inner->p_api->read(p_bt->p_inner, p_data, length, p_cnt);
+    }
+
+    /* Drain the wrapped transport byte by byte so that nothing after the end line is lost. */
+    *p_cnt = 0;
+    do
+    {
+        char   c;
+        size_t cnt;
+
+        ret = p_bt->p_inner->p_api->read(p_bt->p_inner, &c, sizeof(c), &cnt);
+        if ((ret != NRF_SUCCESS) || (cnt == 0))
+        {
+            break;
+        }
+        UNUSED_RETURN_VALUE(cli_batch_feed(p_bt->p_batch, &c, cnt));
+    } while (cli_batch_is_capturing(p_bt->p_batch));
+
+    if (p_bt->p_batch->state == CLI_BATCH_STATE_READY)
+    {
+        p_bt->start = DWT->CYCCNT;
+        if (coop_sched_defer(batch_work, p_bt) != NRF_SUCCESS)
+        {
+            cli_batch_abort(p_bt->p_batch);
+            nrf_cli_error(p_bt->p_cli, "batch: scheduler queue full, batch dropped");
+        }
+    }
+
+    if ((ret != NRF_SUCCESS) || cli_batch_is_capturing(p_bt->p_batch))
+    {
+        return ret;
+    }
+
+    /* The bytes following the end line go to nrf_cli, it gets no new RX event for them. */
+    return p_bt->p_inner->p_api->read(p_bt->p_inner, p_data, length, p_cnt);
+}
+
+const nrf_cli_transport_api_t cli_batch_transport_api =
+{
+    .init   = batch_init,
+    .uninit = batch_uninit,
+    .enable = batch_enable,
+    .write  = batch_write,
+    .read   = batch_read,
+};
+
+static cli_batch_transport_t * batch_transport_get(nrf_cli_t const * p_cli)
+{
+    if (p_cli->p_iface->p_api != &cli_batch_transport_api)
+    {
+        return NULL;
+    }
+    return (cli_batch_transport_t *)p_cli->p_iface;
+}
+
+static void cmd_batch_begin(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    cli_batch_transport_t * p_bt = batch_transport_get(p_cli);
+    if (p_bt == NULL)
+    {
+        nrf_cli_error(p_cli, "batch mode is not supported on this transport");
+        return;
+    }
+
+    if (p_bt->p_batch->state != CLI_BATCH_STATE_IDLE)
+    {
+        nrf_cli_error(p_cli, "batch already active");
+        return;
+    }
+
+    p_bt->p_cli = p_cli;
+    cli_batch_begin(p_bt->p_batch);
+    nrf_cli_print(p_cli, "batch: send commands, finish with '%s'", CLI_BATCH_END_LINE);
+}
+
+static void cmd_batch_end(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    /* Reached only when no capture is active, the end line is consumed by the transport. */
+    nrf_cli_warn(p_cli, "batch not started");
+}
+
+static void cmd_batch_abort(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    cli_batch_transport_t * p_bt = batch_transport_get(p_cli);
+    if (p_bt == NULL)
+    {
+        nrf_cli_error(p_cli, "batch mode is not supported on this transport");
+        return;
+    }
+
+    if (p_bt->p_batch->state == CLI_BATCH_STATE_IDLE)
+    {
+        nrf_cli_warn(p_cli, "batch not started");
+        return;
+    }
+
+    cli_batch_abort(p_bt->p_batch);
+}
+
+static void cmd_batch(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_batch)
+{
+    NRF_CLI_CMD(abort, NULL, "Stop executing the current batch.", cmd_batch_abort),
+    NRF_CLI_CMD(begin, NULL, "Capture commands without echo until 'batch end'.",
+                cmd_batch_begin),
+    NRF_CLI_CMD(end,   NULL, "Finish capturing and execute the batch.", cmd_batch_end),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(batch, &m_sub_batch, "Execute commands in batch mode", cmd_batch);
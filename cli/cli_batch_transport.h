@@ -0,0 +1,57 @@
+/** @file
+ * @defgroup cli_batch_transport CLI batch transport
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief CLI transport wrapper adding batch mode to an existing transport.
+ *
+ * All calls are forwarded to the wrapped transport. After `batch begin` is executed on a CLI
+ * instance using this transport, received bytes are no longer passed to nrf_cli but collected by
+ * the batch engine until `batch end` is received. The captured commands are then executed as
+ * deferred work of the main loop scheduler, bypassing echo, VT100 redraw and history, and an
+ * aggregate status is printed at the end.
+ */
+#ifndef CLI_BATCH_TRANSPORT_H__
+#define CLI_BATCH_TRANSPORT_H__
+
+#include "nrf_cli.h"
+#include "cli_batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const nrf_cli_transport_api_t cli_batch_transport_api;
+
+/**@brief Batch transport instance. */
+typedef struct
+{
+    nrf_cli_transport_t         transport; //!< Transport interface, must be the first member.
+    nrf_cli_transport_t const * p_inner;   //!< Wrapped transport.
+    cli_batch_t *               p_batch;   //!< Batch engine instance.
+    nrf_cli_t const *           p_cli;     //!< CLI instance which started the batch.
+    uint32_t                    start;     //!< CYCCNT value at the start of the execution.
+} cli_batch_transport_t;
+
+/**@brief Macro for defining a batch transport instance.
+ *
+ * @param _name    Instance name.
+ * @param _p_inner Pointer to the wrapped transport.
+ * @param _size    Script buffer size in bytes.
+ */
+#define CLI_BATCH_TRANSPORT_DEF(_name, _p_inner, _size)         \
+    CLI_BATCH_DEF(_name##_batch, _size);                        \
+    static cli_batch_transport_t _name =                        \
+    {                                                           \
+        .transport = { .p_api = &cli_batch_transport_api },     \
+        .p_inner   = (_p_inner),                                \
+        .p_batch   = &_name##_batch,                            \
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CLI_BATCH_TRANSPORT_H__
+
+/** @} */
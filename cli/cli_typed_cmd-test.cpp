@@ -0,0 +1,164 @@
+/* Host test of the typed CLI command handlers.
+ *
+ * Build and run on the host:
+ *   gcc -O2 -c -I../common/host ../common/host/nrf_cli.c
+ *   g++ -std=c++17 -O2 -I../common/host -o cli_typed_cmd-test cli_typed_cmd-test.cpp nrf_cli.o && ./cli_typed_cmd-test
+ *
+ * Command lines are executed by the nrf_cli shim of common/host, which resolves the command and
+ * calls the generated handler the way nrf_cli does. Every line checks whether the typed function
+ * was called, with which values, and how many errors the handler printed.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "cli_typed_cmd.hpp"
+
+enum class mode { slow, fast, off };
+
+template <>
+struct cli::enum_traits<mode>
+{
+    static constexpr cli::enum_entry<mode> entries[] =
+    {
+        { "slow", mode::slow },
+        { "fast", mode::fast },
+        { "off",  mode::off  },
+    };
+};
+
+NRF_CLI_DEF(m_cli, "test:~$ ", &nrf_cli_host_transport, '\n', 0);
+
+static unsigned m_fails;
+static unsigned m_calls;
+
+/* Arguments of the last call. */
+static int8_t   m_i8;
+static uint16_t m_u16;
+static bool     m_flag;
+static mode     m_mode;
+static char     m_name[16];
+static uint32_t m_u32;
+static int64_t  m_i64;
+static uint64_t m_u64;
+
+static void cmd_set(nrf_cli_t const * p_cli, int8_t i8, uint16_t u16, bool flag, mode m)
+{
+    (void)p_cli;
+
+    m_calls++;
+    m_i8   = i8;
+    m_u16  = u16;
+    m_flag = flag;
+    m_mode = m;
+}
+
+static void cmd_name(nrf_cli_t const * p_cli, char const * p_name)
+{
+    (void)p_cli;
+
+    m_calls++;
+    snprintf(m_name, sizeof(m_name), "%s", p_name);
+}
+
+static void cmd_wide(nrf_cli_t const * p_cli, uint32_t u32, int64_t i64, uint64_t u64)
+{
+    (void)p_cli;
+
+    m_calls++;
+    m_u32 = u32;
+    m_i64 = i64;
+    m_u64 = u64;
+}
+
+NRF_CLI_CMD_REGISTER(set, NULL, "Set the values.", cli::typed_handler<cmd_set>::handler);
+NRF_CLI_CMD_REGISTER(name, NULL, "Set the name.", cli::typed_handler<cmd_name>::handler);
+NRF_CLI_CMD_REGISTER(wide, NULL, "Set the wide values.", cli::typed_handler<cmd_wide>::handler);
+
+static void check(bool cond, char const * p_what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", p_what);
+        m_fails++;
+    }
+}
+
+/* Executes a command line, returns the number of errors it printed. */
+static uint32_t run(char const * p_line)
+{
+    char     line[64];
+    uint32_t errors = m_cli.p_ctx->errors;
+
+    printf("%s%s\r\n", m_cli.p_name, p_line);
+    snprintf(line, sizeof(line), "%s", p_line);
+    check(nrf_cli_host_execute(&m_cli, line), "command found");
+    return m_cli.p_ctx->errors - errors;
+}
+
+/* Executes a line that must be rejected with one error, without calling the function. */
+static void reject(char const * p_line, char const * p_what)
+{
+    unsigned calls = m_calls;
+
+    check(run(p_line) == 1, p_what);
+    check(m_calls == calls, p_what);
+}
+
+int main(void)
+{
+    /* Valid arguments */
+    check(run("set -5 65535 on fast") == 0, "valid arguments");
+    check(m_calls == 1, "function called");
+    check((m_i8 == -5) && (m_u16 == 65535) && m_flag && (m_mode == mode::fast), "values");
+
+    check(run("set 0x7f 0 false off") == 0, "hex and limits");
+    check((m_i8 == 127) && (m_u16 == 0) && !m_flag && (m_mode == mode::off), "values");
+
+    check(run("set -128 010 1 slow") == 0, "octal and numeric bool");
+    check((m_i8 == -128) && (m_u16 == 8) && m_flag && (m_mode == mode::slow), "values");
+
+    check(run("name dongle") == 0, "string argument");
+    check(!strcmp(m_name, "dongle"), "string value");
+
+    /* Invalid arguments */
+    reject("set 128 1 on fast",   "int8 above the range");
+    reject("set -129 1 on fast",  "int8 below the range");
+    reject("set 1 65536 on fast", "uint16 above the range");
+    reject("set 1 -1 on fast",    "negative unsigned");
+    reject("set 1x 1 on fast",    "trailing characters");
+    reject("set 1 2 yes fast",    "unknown bool");
+    reject("set 1 2 on medium",   "unknown enum value");
+    reject("set 1 2 on fas",      "enum prefix");
+    reject("set x y z w",         "parsing stops at the first bad argument");
+
+    /* 64-bit types and the limits of unsigned long on the 32-bit target */
+    check(run("wide 4294967295 -9223372036854775808 18446744073709551615") == 0, "wide limits");
+    check((m_u32 == UINT32_MAX) && (m_i64 == INT64_MIN) && (m_u64 == UINT64_MAX), "wide values");
+
+    reject("wide 4294967296 0 0",         "uint32 above the range");
+    reject("wide 0 9223372036854775808 0", "int64 above the range, ERANGE");
+    reject("wide 0 -9223372036854775809 0", "int64 below the range, ERANGE");
+    reject("wide 0 0 18446744073709551616", "uint64 above the range, ERANGE");
+    reject("wide 0 0 -1",                  "negative uint64");
+
+    /* Not reachable through the tokenizer, but the parser must not negate either. */
+    uint64_t u64 = 0;
+    check(!cli::arg_parser<uint64_t>::parse(" -1", u64), "minus sign after white space");
+    check(!cli::arg_parser<uint64_t>::parse("\t-0x1", u64), "minus sign after a tab");
+    check(cli::arg_parser<uint64_t>::parse(" 7", u64) && (u64 == 7), "leading white space");
+
+    /* Wrong argument count */
+    reject("set 1 2 on",           "too few arguments");
+    reject("set 1 2 on fast more", "too many arguments");
+    reject("name",                 "missing argument");
+
+    /* Help is printed, not an error. */
+    unsigned calls = m_calls;
+
+    check(run("set -h") == 0, "help");
+    check(m_calls == calls, "no call for the help");
+
+    printf("%s\r\n", m_fails ? "FAILED" : "PASSED");
+    return m_fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,303 @@
+/** @file
+ * @defgroup cli_typed_cmd Typed CLI command handlers
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Header-only C++17 layer generating nrf_cli handlers from functions with typed
+ *        parameters.
+ *
+ * A handler is written as a plain function taking the CLI instance followed by its arguments:
+ *
+ * @code
+ * enum class led_state { off, on, blink };
+ * template <> struct cli::enum_traits<led_state>
+ * {
+ *     static constexpr cli::enum_entry<led_state> entries[] =
+ *         { { "off", led_state::off }, { "on", led_state::on }, { "blink", led_state::blink } };
+ * };
+ *
+ * static void cmd_led(nrf_cli_t const * p_cli, uint8_t idx, led_state state) { ... }
+ *
+ * NRF_CLI_CMD_REGISTER(led, NULL, "Set LED state.", cli::typed_handler<cmd_led>::handler);
+ * @endcode
+ *
+ * The generated handler prints the help, checks the argument count and converts every argument
+ * before calling the function; on error it prints the usage line derived from the parameter
+ * types. Supported parameter types are integers (range checked), bool, char const * and enums
+ * with an @ref cli::enum_traits specialization. Enum names are matched through a hash computed at
+ * compile time, so a lookup costs one pass over the argument plus one strcmp on a hash hit.
+ *
+ * Nothing is allocated and neither exceptions nor RTTI are used.
+ */
+#ifndef CLI_TYPED_CMD_HPP__
+#define CLI_TYPED_CMD_HPP__
+
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "nrf_cli.h"
+
+namespace cli
+{
+
+/**@brief Enum name to value mapping entry. */
+template <typename E>
+struct enum_entry
+{
+    char const * p_name;
+    E            value;
+};
+
+/**@brief Specialize for every enum used as a handler parameter.
+ *
+ * The specialization must provide `static constexpr enum_entry<E> entries[]`.
+ */
+template <typename E>
+struct enum_traits;
+
+/**@brief FNV-1a hash, usable at compile time. */
+constexpr uint32_t hash(char const * p_str)
+{
+    uint32_t h = 2166136261u;
+    while (*p_str != '\0')
+    {
+        h = (h ^ static_cast<uint8_t>(*p_str++)) * 16777619u;
+    }
+    return h;
+}
+
+namespace detail
+{
+
+template <typename E, std::size_t... I>
+constexpr auto enum_hashes(std::index_sequence<I...>)
+{
+    return std::array<uint32_t, sizeof...(I)>{ hash(enum_traits<E>::entries[I].p_name)... };
+}
+
+template <typename E>
+struct enum_table
+{
+    static constexpr std::size_t count = std::extent<decltype(enum_traits<E>::entries)>::value;
+    static constexpr std::array<uint32_t, count> hashes =
+        enum_hashes<E>(std::make_index_sequence<count>{});
+};
+
+} // namespace detail
+
+/**@brief Argument parser, specialized per parameter type.
+ *
+ * Each specialization provides `static bool parse(char const *, T &)` and a usage string.
+ */
+template <typename T, typename = void>
+struct arg_parser;
+
+template <typename T>
+struct arg_parser<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+{
+    static constexpr char const * usage = std::is_signed_v<T> ? "<int>" : "<uint>";
+
+    /* strtoll()/strtoull() so that 64-bit types parse on the 32-bit target, where long is 32 bits.
+       Out of range input saturates with ERANGE, it is rejected rather than clamped. */
+    static bool parse(char const * p_arg, T & value)
+    {
+        char * p_end;
+
+        errno = 0;
+        if constexpr (std::is_signed_v<T>)
+        {
+            long long v = std::strtoll(p_arg, &p_end, 0);
+            if ((errno == ERANGE) ||
+                (v < std::numeric_limits<T>::min()) || (v > std::numeric_limits<T>::max()))
+            {
+                return false;
+            }
+            value = static_cast<T>(v);
+        }
+        else
+        {
+            /* strtoull() accepts a minus sign after leading white space and negates the value. */
+            char const * p_sign = p_arg;
+            while (std::isspace(static_cast<unsigned char>(*p_sign)))
+            {
+                p_sign++;
+            }
+            if (*p_sign == '-')
+            {
+                return false;
+            }
+            unsigned long long v = std::strtoull(p_arg, &p_end, 0);
+            if ((errno == ERANGE) || (v > std::numeric_limits<T>::max()))
+            {
+                return false;
+            }
+            value = static_cast<T>(v);
+        }
+        return (p_end != p_arg) && (*p_end == '\0');
+    }
+};
+
+template <>
+struct arg_parser<bool>
+{
+    static constexpr char const * usage = "<on|off>";
+
+    static bool parse(char const * p_arg, bool & value)
+    {
+        static constexpr enum_entry<bool> names[] =
+        {
+            { "on",  true  }, { "1", true  }, { "true",  true  },
+            { "off", false }, { "0", false }, { "false", false },
+        };
+
+        for (auto const & name : names)
+        {
+            if (!std::strcmp(name.p_name, p_arg))
+            {
+                value = name.value;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+template <>
+struct arg_parser<char const *>
+{
+    static constexpr char const * usage = "<string>";
+
+    static bool parse(char const * p_arg, char const * & value)
+    {
+        value = p_arg;
+        return true;
+    }
+};
+
+template <typename E>
+struct arg_parser<E, std::enable_if_t<std::is_enum_v<E>>>
+{
+    static constexpr char const * usage = "<value>";
+
+    static bool parse(char const * p_arg, E & value)
+    {
+        uint32_t h = hash(p_arg);
+
+        for (std::size_t i = 0; i < detail::enum_table<E>::count; i++)
+        {
+            if ((detail::enum_table<E>::hashes[i] == h) &&
+                !std::strcmp(enum_traits<E>::entries[i].p_name, p_arg))
+            {
+                value = enum_traits<E>::entries[i].value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void print_values(nrf_cli_t const * p_cli)
+    {
+        for (std::size_t i = 0; i < detail::enum_table<E>::count; i++)
+        {
+            nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "%s%s",
+                            (i == 0) ? "<" : "|", enum_traits<E>::entries[i].p_name);
+        }
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, ">");
+    }
+};
+
+namespace detail
+{
+
+template <typename T>
+void usage_print(nrf_cli_t const * p_cli)
+{
+    nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, " ");
+    if constexpr (std::is_enum_v<T>)
+    {
+        arg_parser<T>::print_values(p_cli);
+    }
+    else
+    {
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "%s", arg_parser<T>::usage);
+    }
+}
+
+} // namespace detail
+
+/**@brief Generates an nrf_cli handler for @p Fn.
+ *
+ * @tparam Fn Function taking `nrf_cli_t const *` followed by the typed arguments.
+ */
+template <auto Fn>
+struct typed_handler;
+
+template <typename... Args, void (*Fn)(nrf_cli_t const *, Args...)>
+struct typed_handler<Fn>
+{
+    static void handler(nrf_cli_t const * p_cli, size_t argc, char ** argv)
+    {
+        if (nrf_cli_help_requested(p_cli))
+        {
+            nrf_cli_help_print(p_cli, nullptr, 0);
+            usage(p_cli, argv[0]);
+            return;
+        }
+
+        if (argc != (sizeof...(Args) + 1))
+        {
+            nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+            usage(p_cli, argv[0]);
+            return;
+        }
+
+        invoke(p_cli, argv, std::index_sequence_for<Args...>{});
+    }
+
+private:
+    static void usage(nrf_cli_t const * p_cli, char const * p_name)
+    {
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "usage: %s", p_name);
+        (detail::usage_print<std::decay_t<Args>>(p_cli), ...);
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\n");
+    }
+
+    template <std::size_t I, typename T>
+    static bool parse(nrf_cli_t const * p_cli, char ** argv, T & value)
+    {
+        if (arg_parser<T>::parse(argv[I + 1], value))
+        {
+            return true;
+        }
+        nrf_cli_error(p_cli, "%s: bad parameter %u: %s",
+                      argv[0], static_cast<unsigned>(I + 1), argv[I + 1]);
+        usage(p_cli, argv[0]);
+        return false;
+    }
+
+    template <std::size_t... I>
+    static void invoke(nrf_cli_t const * p_cli, [[maybe_unused]] char ** argv,
+                       std::index_sequence<I...>)
+    {
+        std::tuple<std::decay_t<Args>...> values{};
+
+        if ((parse<I>(p_cli, argv, std::get<I>(values)) && ...))
+        {
+            Fn(p_cli, std::get<I>(values)...);
+        }
+    }
+};
+
+} // namespace cli
+
+#endif // CLI_TYPED_CMD_HPP__
+
+/** @} */
@@ -46,6 +46,256 @@
 #ifdef USE_APP_CONFIG
 #include "app_config.h"
 #endif
+// <h> Application
+
+//==========================================================
+// <h> coop_sched - Cooperative main loop scheduler
+
+// <i> Budgets are given in CPU cycles (64 cycles per microsecond).
+//==========================================================
+// <o> COOP_SCHED_LOG_BUDGET_CYCLES - Logger processing budget per loop iteration.
+#ifndef COOP_SCHED_LOG_BUDGET_CYCLES
+#define COOP_SCHED_LOG_BUDGET_CYCLES 64000
+#endif
+
+// <o> COOP_SCHED_CLI_BUDGET_CYCLES - CLI instance processing budget per loop iteration.
+#ifndef COOP_SCHED_CLI_BUDGET_CYCLES
+#define COOP_SCHED_CLI_BUDGET_CYCLES 320000
+#endif
+
+// <o> COOP_SCHED_DEFER_BUDGET_CYCLES - Deferred work budget per loop iteration.
+#ifndef COOP_SCHED_DEFER_BUDGET_CYCLES
+#define COOP_SCHED_DEFER_BUDGET_CYCLES 128000
+#endif
+
+// <o> COOP_SCHED_DEFER_QUEUE_SIZE - Maximum number of deferred work items.
+#ifndef COOP_SCHED_DEFER_QUEUE_SIZE
+#define COOP_SCHED_DEFER_QUEUE_SIZE 4
+#endif
+
+// <q> COOP_SCHED_CLI_CMDS  - Enable CLI commands specific to the module.
+
+
+#ifndef COOP_SCHED_CLI_CMDS
+#define COOP_SCHED_CLI_CMDS 1
+#endif
+
+// </h>
+//==========================================================
+
+// <h> cli_batch - CLI batch mode
+
+//==========================================================
+// <o> CLI_BATCH_BUFFER_SIZE - Size of the buffer holding a captured script.
+#ifndef CLI_BATCH_BUFFER_SIZE
+#define CLI_BATCH_BUFFER_SIZE 2048
+#endif
+
+// </h>
+//==========================================================
+
+// <h> telemetry - Telemetry counters
+
+//==========================================================
+// <o> TELEMETRY_MAX_COUNTERS - Maximum number of counters stored in a sample.
+#ifndef TELEMETRY_MAX_COUNTERS
+#define TELEMETRY_MAX_COUNTERS 8
+#endif
+
+// <o> TELEMETRY_BUFFER_SAMPLES - Number of samples in the ring buffer. Must be a power of 2.
+#ifndef TELEMETRY_BUFFER_SAMPLES
+#define TELEMETRY_BUFFER_SAMPLES 64
+#endif
+
+// <o> TELEMETRY_SAMPLE_INTERVAL_MS - Default sampling interval in milliseconds.
+#ifndef TELEMETRY_SAMPLE_INTERVAL_MS
+#define TELEMETRY_SAMPLE_INTERVAL_MS 1000
+#endif
+
+// </h>
+//==========================================================
+
+// <h> timestamp - 64-bit timestamp source
+
+//==========================================================
+// <o> TIMESTAMP_SOURCE - Default timestamp source.
+
+// <0=> RTC
+// <1=> CYCCNT
+// <2=> Fused
+
+#ifndef TIMESTAMP_SOURCE
+#define TIMESTAMP_SOURCE 2
+#endif
+
+// <o> TIMESTAMP_SYNC_INTERVAL_MS - Interval of the counter reads in milliseconds.
+// <i> Must be shorter than a CYCCNT wrap (67 s at 64 MHz).
+#ifndef TIMESTAMP_SYNC_INTERVAL_MS
+#define TIMESTAMP_SYNC_INTERVAL_MS 30000
+#endif
+
+// </h>
+//==========================================================
+
+// <e> BENCH_ENABLED - bench - Micro-benchmarks
+
+// <i> Adds the bench CLI command running the benchmarks of bench_cases.c.
+//==========================================================
+#ifndef BENCH_ENABLED
+#define BENCH_ENABLED 1
+#endif
+// <o> BENCH_WARMUP - Calls of the benchmark function before the first sample.
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP 8
+#endif
+
+// <o> BENCH_SAMPLES - Samples per run.
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES 64
+#endif
+
+// </e>
+
+// <e> STACK_USAGE_ENABLED - stack_usage - Stack high-water marks
+
+// <i> Paints the main stack at boot and adds the stack CLI command.
+//==========================================================
+#ifndef STACK_USAGE_ENABLED
+#define STACK_USAGE_ENABLED 1
+#endif
+// </e>
+
+// <e> LOG_BACKEND_BIN_ENABLED - log_backend_bin - Binary logger backend over RTT
+
+// <i> Log entries are sent unformatted on their own RTT channel, decode them with
+// <i> apps/log/log_decode.py. The CLI instances then get no log backend: formatting next to
+// <i> the binary backend would cost as much as before, so the logs leave the consoles.
+// <i> Enable it when the log rate matters more than reading the logs on the USB or RTT console.
+//==========================================================
+#ifndef LOG_BACKEND_BIN_ENABLED
+#define LOG_BACKEND_BIN_ENABLED 0
+#endif
+// <o> LOG_BACKEND_BIN_RTT_CHANNEL - RTT up channel used by the backend.
+// <i> Channel 0 is used by the RTT CLI transport.
+#ifndef LOG_BACKEND_BIN_RTT_CHANNEL
+#define LOG_BACKEND_BIN_RTT_CHANNEL 1
+#endif
+
+// <o> LOG_BACKEND_BIN_RTT_BUFFER_SIZE - Size of the RTT up buffer.
+#ifndef LOG_BACKEND_BIN_RTT_BUFFER_SIZE
+#define LOG_BACKEND_BIN_RTT_BUFFER_SIZE 1024
+#endif
+
+// <o> LOG_BACKEND_BIN_FRAME_SIZE - Maximum size of an encoded entry.
+// <i> Inlined RAM strings and hexdumps are truncated to fit.
+#ifndef LOG_BACKEND_BIN_FRAME_SIZE
+#define LOG_BACKEND_BIN_FRAME_SIZE 128
+#endif
+
+// <o> LOG_BACKEND_BIN_SYNC_INTERVAL - Number of frames between absolute timestamps.
+#ifndef LOG_BACKEND_BIN_SYNC_INTERVAL
+#define LOG_BACKEND_BIN_SYNC_INTERVAL 32
+#endif
+
+// </e>
+
+// <e> LOG_STORE_ENABLED - log_backend_store - Compressed flash logger backend
+
+// <i> Replaces the flashlog backend of nrf_log_backend_flash.
+//==========================================================
+#ifndef LOG_STORE_ENABLED
+#define LOG_STORE_ENABLED 1
+#endif
+// <o> LOG_STORE_START_PAGE - First flash page of the log store.
+// <i> The default range ends where the FDS pages start. The FLASH region of
+// <i> armgcc/linker.ld must end below it.
+#ifndef LOG_STORE_START_PAGE
+#define LOG_STORE_START_PAGE 217
+#endif
+
+// <o> LOG_STORE_PAGES - Number of pages. At least 2.
+#ifndef LOG_STORE_PAGES
+#define LOG_STORE_PAGES 4
+#endif
+
+// <o> LOG_STORE_BLOCK_SIZE - Size of the RAM block compressed at once.
+// <i> Larger blocks compress better and are programmed less often, a block
+// <i> must fit in a page once compressed.
+#ifndef LOG_STORE_BLOCK_SIZE
+#define LOG_STORE_BLOCK_SIZE 2048
+#endif
+
+// </e>
+
+// <e> CRASH_LOG_ENABLED - crash_log - Crash capture to no-init RAM
+
+// <i> Replaces the crashlog backend of nrf_log_backend_flash.
+//==========================================================
+#ifndef CRASH_LOG_ENABLED
+#define CRASH_LOG_ENABLED 1
+#endif
+// <o> CRASH_LOG_ENTRIES - Number of log entries kept for the crash record.
+#ifndef CRASH_LOG_ENTRIES
+#define CRASH_LOG_ENTRIES 16
+#endif
+
+// <o> CRASH_LOG_STACK_WORDS - Number of stack words saved.
+#ifndef CRASH_LOG_STACK_WORDS
+#define CRASH_LOG_STACK_WORDS 32
+#endif
+
+// <o> CRASH_LOG_FLASH_PAGE - Flash page holding the last crash.
+// <i> The default is the page below the log store, where the FLASH region of
+// <i> armgcc/linker.ld ends.
+#ifndef CRASH_LOG_FLASH_PAGE
+#define CRASH_LOG_FLASH_PAGE 216
+#endif
+
+// </e>
+
+// <h> log_throttle - Logger overflow accounting and throttling
+
+//==========================================================
+// <q> LOG_THROTTLE_AUTO  - Throttle automatically above the high watermark.
+
+
+#ifndef LOG_THROTTLE_AUTO
+#define LOG_THROTTLE_AUTO 1
+#endif
+
+// <o> LOG_THROTTLE_HIGH_WATERMARK - Buffer occupancy in percent that starts throttling.
+#ifndef LOG_THROTTLE_HIGH_WATERMARK
+#define LOG_THROTTLE_HIGH_WATERMARK 75
+#endif
+
+// <o> LOG_THROTTLE_LOW_WATERMARK - Buffer occupancy in percent that stops throttling.
+#ifndef LOG_THROTTLE_LOW_WATERMARK
+#define LOG_THROTTLE_LOW_WATERMARK 25
+#endif
+
+// <o> LOG_THROTTLE_SEVERITY  - Least severe level accepted while throttling.
+
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef LOG_THROTTLE_SEVERITY
+#define LOG_THROTTLE_SEVERITY 2
+#endif
+
+// <o> LOG_THROTTLE_MAX_MODULES - Number of modules with own counters.
+// <i> Modules with higher IDs share the last counters.
+#ifndef LOG_THROTTLE_MAX_MODULES
+#define LOG_THROTTLE_MAX_MODULES 64
+#endif
+
+// </h>
+//==========================================================
+
+// </h>
+//==========================================================
+
 // <h> nRF_Core 
 
 //==========================================================
@@ -2038,7 +2288,7 @@
 // <e> NRF_LOG_BACKEND_FLASH_ENABLED - nrf_log_backend_flash - Log flash backend
 //==========================================================
 #ifndef NRF_LOG_BACKEND_FLASH_ENABLED
-#define NRF_LOG_BACKEND_FLASH_ENABLED 1
+#define NRF_LOG_BACKEND_FLASH_ENABLED 0
 #endif
 // <q> NRF_LOG_BACKEND_FLASH_CLI_CMDS  - Enable CLI commands for this module.
  
@@ -2050,7 +2300,7 @@
 // <e> NRF_LOG_BACKEND_FLASHLOG_ENABLED - Enable flashlog backend.
 //==========================================================
 #ifndef NRF_LOG_BACKEND_FLASHLOG_ENABLED
-#define NRF_LOG_BACKEND_FLASHLOG_ENABLED 1
+#define NRF_LOG_BACKEND_FLASHLOG_ENABLED 0
 #endif
 // <o> NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE - Logger messages queue size. 
 // <i> Queue holds log messages pending to be written to flash.
@@ -2066,7 +2316,7 @@
 // <e> NRF_LOG_BACKEND_CRASHLOG_ENABLED - Enable crashlog backend.
 //==========================================================
 #ifndef NRF_LOG_BACKEND_CRASHLOG_ENABLED
-#define NRF_LOG_BACKEND_CRASHLOG_ENABLED 1
+#define NRF_LOG_BACKEND_CRASHLOG_ENABLED 0
 #endif
 // <o> NRF_LOG_BACKEND_CRASHLOG_FIFO_SIZE - Number of log messages held to be flushed in panic. 
 // <i> Crashlog FIFO always keeps a defined number of the most
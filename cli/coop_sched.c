@@ -0,0 +1,262 @@
+#include "sdk_common.h"
+#include "coop_sched.h"
+
+#include <stdlib.h>
+
+#include "nrf.h"
+#include "nrf_pwr_mgmt.h"
+#include "nrf_cli.h"
+#include "bench_dwt.h"
+
+/* Internal slot used to resume handlers queued with coop_sched_defer(). */
+static bool defer_poll(void * p_context);
+
+typedef struct
+{
+    coop_sched_work_t handler;
+    void *            p_context;
+} coop_sched_work_item_t;
+
+static coop_sched_slot_t * mp_slots;
+static size_t              m_slot_cnt;
+
+static coop_sched_slot_t m_defer_slot =
+    COOP_SCHED_SLOT("defer", defer_poll, NULL, COOP_SCHED_DEFER_BUDGET_CYCLES);
+
+static coop_sched_work_item_t m_work_queue[COOP_SCHED_DEFER_QUEUE_SIZE];
+static uint8_t                m_work_head;
+static uint8_t                m_work_cnt;
+
+static inline uint32_t cycles_get(void)
+{
+    return DWT->CYCCNT;
+}
+
+/* Resumes the oldest deferred handler. Unfinished handlers go to the back of the queue so that
+   several of them share the budget in a round robin manner. */
+static bool defer_poll(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (m_work_cnt == 0)
+    {
+        return false;
+    }
+
+    coop_sched_work_item_t item = m_work_queue[m_work_head];
+    m_work_head = (m_work_head + 1) % COOP_SCHED_DEFER_QUEUE_SIZE;
+    m_work_cnt--;
+
+    if (item.handler(item.p_context))
+    {
+        m_work_queue[(m_work_head + m_work_cnt) % COOP_SCHED_DEFER_QUEUE_SIZE] = item;
+        m_work_cnt++;
+    }
+
+    return (m_work_cnt != 0);
+}
+
+static bool slot_run(coop_sched_slot_t * p_slot)
+{
+    uint32_t start = cycles_get();
+    uint32_t elapsed;
+    bool     pending;
+
+    do
+    {
+        pending = p_slot->poll(p_slot->p_context);
+        elapsed = cycles_get() - start;
+    } while (pending && (elapsed < p_slot->budget_cycles));
+
+    p_slot->runs++;
+    if (elapsed > p_slot->max_cycles)
+    {
+        p_slot->max_cycles = elapsed;
+    }
+    if (elapsed > p_slot->budget_cycles)
+    {
+        p_slot->overruns++;
+    }
+
+    return pending;
+}
+
+void coop_sched_init(coop_sched_slot_t * p_slots, size_t count)
+{
+    ASSERT((p_slots != NULL) || (count == 0));
+
+    mp_slots   = p_slots;
+    m_slot_cnt = count;
+
+    bench_dwt_enable();
+}
+
+void coop_sched_run(void)
+{
+    bool pending = false;
+
+    for (size_t i = 0; i < m_slot_cnt; i++)
+    {
+        pending |= slot_run(&mp_slots[i]);
+    }
+
+    pending |= slot_run(&m_defer_slot);
+
+    if (!pending)
+    {
+        /* Any interrupt (USB, RTC driving app_timer and the RTT poll) wakes the core up. */
+        nrf_pwr_mgmt_run();
+    }
+}
+
+ret_code_t coop_sched_defer(coop_sched_work_t handler, void * p_context)
+{
+    ASSERT(handler);
+
+    if (m_work_cnt >= COOP_SCHED_DEFER_QUEUE_SIZE)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    m_work_queue[(m_work_head + m_work_cnt) % COOP_SCHED_DEFER_QUEUE_SIZE] =
+        (coop_sched_work_item_t){ .handler = handler, .p_context = p_context };
+    m_work_cnt++;
+
+    return NRF_SUCCESS;
+}
+
+size_t coop_sched_slot_count(void)
+{
+    return m_slot_cnt + 1;
+}
+
+coop_sched_slot_t * coop_sched_slot_get(size_t idx)
+{
+    if (idx < m_slot_cnt)
+    {
+        return &mp_slots[idx];
+    }
+
+    return (idx == m_slot_cnt) ? &m_defer_slot : NULL;
+}
+
+#if COOP_SCHED_CLI_CMDS
+
+static coop_sched_slot_t * slot_find(char const * p_name)
+{
+    for (size_t i = 0; i < coop_sched_slot_count(); i++)
+    {
+        coop_sched_slot_t * p_slot = coop_sched_slot_get(i);
+        if (!strcmp(p_slot->p_name, p_name))
+        {
+            return p_slot;
+        }
+    }
+    return NULL;
+}
+
+static void cmd_sched_stats(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    nrf_cli_print(p_cli, "%-8s %10s %10s %10s %8s", "slot", "budget", "max", "runs", "overruns");
+    for (size_t i = 0; i < coop_sched_slot_count(); i++)
+    {
+        coop_sched_slot_t const * p_slot = coop_sched_slot_get(i);
+        nrf_cli_print(p_cli, "%-8s %10u %10u %10u %8u",
+                      p_slot->p_name,
+                      p_slot->budget_cycles,
+                      p_slot->max_cycles,
+                      p_slot->runs,
+                      p_slot->overruns);
+    }
+    nrf_cli_print(p_cli, "deferred work queued: %u", m_work_cnt);
+}
+
+static void cmd_sched_reset(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    for (size_t i = 0; i < coop_sched_slot_count(); i++)
+    {
+        coop_sched_slot_t * p_slot = coop_sched_slot_get(i);
+        p_slot->runs       = 0;
+        p_slot->max_cycles = 0;
+        p_slot->overruns   = 0;
+    }
+}
+
+static void cmd_sched_budget(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 3)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    coop_sched_slot_t * p_slot = slot_find(argv[1]);
+    if (p_slot == NULL)
+    {
+        nrf_cli_error(p_cli, "%s: unknown slot: %s", argv[0], argv[1]);
+        return;
+    }
+
+    char * p_end;
+    unsigned long budget = strtoul(argv[2], &p_end, 0);
+    if ((*p_end != '\0') || (budget == 0))
+    {
+        nrf_cli_error(p_cli, "%s: bad budget: %s", argv[0], argv[2]);
+        return;
+    }
+
+    p_slot->budget_cycles = (uint32_t)budget;
+}
+
+static void cmd_sched(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_sched)
+{
+    NRF_CLI_CMD(budget, NULL, "Set slot budget in CPU cycles: budget <slot> <cycles>.",
+                cmd_sched_budget),
+    NRF_CLI_CMD(reset,  NULL, "Reset scheduler statistics.", cmd_sched_reset),
+    NRF_CLI_CMD(stats,  NULL, "Show per slot cycle usage.",  cmd_sched_stats),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(sched, &m_sub_sched, "Main loop scheduler commands", cmd_sched);
+
+#endif // COOP_SCHED_CLI_CMDS
@@ -0,0 +1,121 @@
+/** @file
+ * @defgroup coop_sched Cooperative main loop scheduler
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Runs the main loop pollers (logger, CLI instances, deferred work) with a per-iteration
+ *        CPU cycle budget and puts the core to sleep when none of them has pending work.
+ *
+ * Every poller is described by a @ref coop_sched_slot_t. During one call to
+ * @ref coop_sched_run each slot is polled repeatedly until it reports no more pending work or its
+ * budget (measured with DWT CYCCNT) is used up. A poller that cannot be split (e.g.
+ * nrf_cli_process) is called once and only accounted for, so overruns show up in the statistics.
+ *
+ * Long running CLI handlers should not loop until they are done. Instead they do a first chunk of
+ * work and hand the rest over with @ref coop_sched_defer; the scheduler resumes them in the
+ * following iterations within the deferred work budget, so other consoles keep being serviced.
+ */
+#ifndef COOP_SCHED_H__
+#define COOP_SCHED_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Poll function of a scheduler slot.
+ *
+ * @param[in] p_context Slot context.
+ *
+ * @retval true  More work is pending, the slot may be polled again within the same iteration.
+ * @retval false Nothing left to do for now.
+ */
+typedef bool (*coop_sched_poll_t)(void * p_context);
+
+/**@brief Deferred work handler.
+ *
+ * @param[in] p_context Context given to @ref coop_sched_defer.
+ *
+ * @retval true  Handler has not finished and shall be resumed later.
+ * @retval false Handler has finished.
+ */
+typedef bool (*coop_sched_work_t)(void * p_context);
+
+/**@brief Scheduler slot. */
+typedef struct
+{
+    char const *      p_name;        //!< Name printed by the CLI command.
+    coop_sched_poll_t poll;          //!< Poll function.
+    void *            p_context;     //!< Context passed to the poll function.
+    uint32_t          budget_cycles; //!< CPU cycles the slot may use per loop iteration.
+    uint32_t          runs;          //!< Number of iterations in which the slot was polled.
+    uint32_t          max_cycles;    //!< Longest time spent in the slot during one iteration.
+    uint32_t          overruns;      //!< Number of iterations in which the budget was exceeded.
+} coop_sched_slot_t;
+
+/**@brief Macro for defining a scheduler slot.
+ *
+ * @param _name   Slot name.
+ * @param _poll   Poll function.
+ * @param _ctx    Poll function context.
+ * @param _budget Budget in CPU cycles.
+ */
+#define COOP_SCHED_SLOT(_name, _poll, _ctx, _budget) \
+    {                                                \
+        .p_name        = (_name),                    \
+        .poll          = (_poll),                    \
+        .p_context     = (_ctx),                     \
+        .budget_cycles = (_budget),                  \
+    }
+
+/**@brief Function for initializing the scheduler.
+ *
+ * Enables the DWT cycle counter if it is not running yet.
+ *
+ * @param[in] p_slots Array of slots, polled in the given order. Must stay valid.
+ * @param[in] count   Number of slots.
+ */
+void coop_sched_init(coop_sched_slot_t * p_slots, size_t count);
+
+/**@brief Function for executing one main loop iteration.
+ *
+ * Polls all slots and the deferred work queue. If nothing is pending afterwards the core goes to
+ * sleep until the next event.
+ */
+void coop_sched_run(void);
+
+/**@brief Function for queuing work to be resumed by the scheduler.
+ *
+ * Must be called from the main loop context (e.g. from a CLI command handler).
+ *
+ * @param[in] handler   Work handler, called until it returns false.
+ * @param[in] p_context Handler context.
+ *
+ * @retval NRF_SUCCESS      Work queued.
+ * @retval NRF_ERROR_NO_MEM Deferred work queue is full.
+ */
+ret_code_t coop_sched_defer(coop_sched_work_t handler, void * p_context);
+
+/**@brief Function for getting the number of slots, including the deferred work slot. */
+size_t coop_sched_slot_count(void);
+
+/**@brief Function for getting a slot.
+ *
+ * @param[in] idx Slot index. The last slot is the deferred work slot.
+ *
+ * @return Slot or NULL if @p idx is out of range.
+ */
+coop_sched_slot_t * coop_sched_slot_get(size_t idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COOP_SCHED_H__
+
+/** @} */
@@ -0,0 +1,425 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(CRASH_LOG)
+#include "crash_log.h"
+
+#include <string.h>
+
+#include "nrf.h"
+#include "app_error.h"
+#include "log_backend_bin.h"
+#include "nrf_fstorage.h"
+#include "nrf_fstorage_nvmc.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+#include "nrf_memobj.h"
+#include "nrf_strerror.h"
+#include "nrf_cli.h"
+
+#define PAGE_SIZE       0x1000
+#define PAGE_ADDR       (CRASH_LOG_FLASH_PAGE * PAGE_SIZE)
+
+/* Size of the NOINIT region of linker.ld, holding m_crash. */
+#define NOINIT_SIZE     0x500
+
+/* Number of words stacked by the exception entry: R0-R3, R12, LR, PC, xPSR. */
+#define FRAME_WORDS     8
+
+typedef struct
+{
+    crash_log_record_t record;
+    uint8_t            ring[CRASH_LOG_ENTRIES][CRASH_LOG_ENTRY_SIZE];
+} crash_log_t;
+
+/* The slot length byte doubles as the varint length expected by log_decode.py --hex. */
+STATIC_ASSERT(CRASH_LOG_ENTRY_SIZE <= 0x80);
+STATIC_ASSERT((sizeof(crash_log_t) % sizeof(uint32_t)) == 0);
+STATIC_ASSERT(sizeof(crash_log_t) <= PAGE_SIZE);
+STATIC_ASSERT(sizeof(crash_log_t) <= NOINIT_SIZE);
+
+/* Main stack boundaries, from the linker script. */
+extern uint32_t __StackLimit;
+extern uint32_t __StackTop;
+
+/* Fixed region above the application RAM, neither initialized nor cleared on reset, see
+   linker.ld. */
+static crash_log_t m_crash __attribute__((section(".noinit")));
+
+static log_backend_bin_enc_t m_enc;
+static bool volatile         m_saving;  /* Ring frozen until the record is in flash. */
+
+static void fstorage_evt_handler(nrf_fstorage_evt_t * p_evt);
+
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_fstorage) =
+{
+    .evt_handler = fstorage_evt_handler,
+    .start_addr  = PAGE_ADDR,
+    .end_addr    = PAGE_ADDR + PAGE_SIZE,
+};
+
+static void crash_log_put(nrf_log_backend_t const * p_backend, nrf_log_entry_t * p_msg)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    if (m_saving)
+    {
+        return;
+    }
+
+    uint8_t * p_slot = m_crash.ring[m_crash.record.log_head % CRASH_LOG_ENTRIES];
+
+    /* Absolute timestamps only, so that the oldest slot decodes on its own. */
+    m_enc.frame_cnt = 0;
+
+    nrf_memobj_get(p_msg);
+    p_slot[0] = (uint8_t)log_backend_bin_encode(&m_enc, p_msg, &p_slot[1],
+                                                CRASH_LOG_ENTRY_SIZE - 1);
+    nrf_memobj_put(p_msg);
+
+    /* Advanced last: a slot being written when the crash happens is not part of the record. */
+    m_crash.record.log_head++;
+}
+
+static void crash_log_flush(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+}
+
+static void crash_log_panic_set(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+}
+
+static const nrf_log_backend_api_t m_crash_log_api =
+{
+    .put       = crash_log_put,
+    .flush     = crash_log_flush,
+    .panic_set = crash_log_panic_set,
+};
+
+NRF_LOG_BACKEND_DEF(m_crash_log_backend, m_crash_log_api, NULL);
+
+static bool stack_is_valid(uint32_t const * p_sp, uint32_t words)
+{
+    return (p_sp >= &__StackLimit) && ((p_sp + words) <= &__StackTop);
+}
+
+static void stack_copy(uint32_t const * p_sp)
+{
+    crash_log_record_t * p_rec = &m_crash.record;
+    uint32_t             words = 0;
+
+    if (stack_is_valid(p_sp, 0))
+    {
+        words = MIN((uint32_t)(&__StackTop - p_sp), CRASH_LOG_STACK_WORDS);
+        memcpy(p_rec->stack, p_sp, words * sizeof(uint32_t));
+    }
+    p_rec->sp          = (uint32_t)p_sp;
+    p_rec->stack_words = words;
+}
+
+static void fault_regs_copy(void)
+{
+    crash_log_record_t * p_rec = &m_crash.record;
+
+    p_rec->cfsr  = SCB->CFSR;
+    p_rec->hfsr  = SCB->HFSR;
+    p_rec->mmfar = SCB->MMFAR;
+    p_rec->bfar  = SCB->BFAR;
+}
+
+static void capture_end(uint32_t start)
+{
+    m_crash.record.capture_cycles = DWT->CYCCNT - start;
+    m_crash.record.magic          = CRASH_LOG_MAGIC;
+    __DSB();
+
+#if defined(DEBUG)
+    if (CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk)
+    {
+        __BKPT(0);
+    }
+#endif
+
+    NVIC_SystemReset();
+}
+
+/* Called by HardFault_Handler() from hardfault_handler_gcc.c, with the exception frame or NULL
+   if the stack pointer was outside of the stack. */
+void HardFault_c_handler(uint32_t * p_stack_address)
+{
+    uint32_t             start = DWT->CYCCNT;
+    crash_log_record_t * p_rec = &m_crash.record;
+
+    p_rec->reason = CRASH_LOG_REASON_HARDFAULT;
+    fault_regs_copy();
+
+    if ((p_stack_address != NULL) && stack_is_valid(p_stack_address, FRAME_WORDS))
+    {
+        memcpy(p_rec->regs, p_stack_address, sizeof(p_rec->regs));
+        stack_copy(&p_stack_address[FRAME_WORDS]);
+    }
+    else
+    {
+        memset(p_rec->regs, 0, sizeof(p_rec->regs));
+        p_rec->sp          = 0;
+        p_rec->stack_words = 0;
+    }
+
+    capture_end(start);
+}
+
+/* Replaces the weak handler of app_error_weak.c. Nothing is logged or flushed here: the panic
+   flush would run the store backend, compressing and programming flash in the fault path. The
+   error is logged from the record after the reset, see record_log(). */
+void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info)
+{
+    uint32_t             start = DWT->CYCCNT;
+    crash_log_record_t * p_rec = &m_crash.record;
+
+    __disable_irq();
+
+    memset(p_rec->regs, 0, sizeof(p_rec->regs));
+    p_rec->reason  = CRASH_LOG_REASON_APP_ERROR;
+    p_rec->regs[0] = id;
+    p_rec->regs[1] = pc;
+    p_rec->regs[2] = info;
+    if (id == NRF_FAULT_ID_SDK_ERROR)
+    {
+        error_info_t const * p_info = (error_info_t const *)info;
+
+        p_rec->regs[3] = p_info->err_code;
+        p_rec->regs[4] = p_info->line_num;
+        p_rec->regs[5] = (uint32_t)p_info->p_file_name;
+    }
+    else if (id == NRF_FAULT_ID_SDK_ASSERT)
+    {
+        assert_info_t const * p_info = (assert_info_t const *)info;
+
+        p_rec->regs[4] = p_info->line_num;
+        p_rec->regs[5] = (uint32_t)p_info->p_file_name;
+    }
+    fault_regs_copy();
+    stack_copy((uint32_t const *)__get_MSP());
+
+    capture_end(start);
+}
+
+static void ring_reset(void)
+{
+    memset(&m_crash, 0, sizeof(m_crash));
+}
+
+static void fstorage_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    if ((p_evt->id == NRF_FSTORAGE_EVT_ERASE_RESULT) && (p_evt->result == NRF_SUCCESS) &&
+        m_saving)
+    {
+        /* The source must stay untouched until the write completes, the ring is frozen. */
+        if (nrf_fstorage_write(&m_fstorage, PAGE_ADDR, &m_crash, sizeof(m_crash), NULL) ==
+            NRF_SUCCESS)
+        {
+            return;
+        }
+    }
+
+    if (m_saving)
+    {
+        ring_reset();
+        m_saving = false;
+    }
+}
+
+/* Logs the crash found after the reset, in place of the lines the SDK handler would have logged
+   in the fault path. */
+static void record_log(crash_log_record_t const * p_rec)
+{
+    if (p_rec->reason != CRASH_LOG_REASON_APP_ERROR)
+    {
+        NRF_LOG_ERROR("Reset by a hard fault at pc 0x%08x, CFSR 0x%08x",
+                      p_rec->regs[6], p_rec->cfsr);
+    }
+    else if (p_rec->regs[0] == NRF_FAULT_ID_SDK_ERROR)
+    {
+        NRF_LOG_ERROR("Reset by ERROR %u [%s] at line %u, PC at: 0x%08x",
+                      p_rec->regs[3], nrf_strerror_get(p_rec->regs[3]),
+                      p_rec->regs[4], p_rec->regs[1]);
+    }
+    else if (p_rec->regs[0] == NRF_FAULT_ID_SDK_ASSERT)
+    {
+        NRF_LOG_ERROR("Reset by ASSERTION FAILED at line %u", p_rec->regs[4]);
+    }
+    else
+    {
+        NRF_LOG_ERROR("Reset by UNKNOWN FAULT at 0x%08X", p_rec->regs[1]);
+    }
+    NRF_LOG_ERROR("%u log entries before the crash saved, see crashlog show",
+                  MIN(p_rec->log_head, CRASH_LOG_ENTRIES));
+}
+
+ret_code_t crash_log_init(nrf_log_severity_t severity)
+{
+    ret_code_t ret;
+    int32_t    backend_id;
+
+    ret = nrf_fstorage_init(&m_fstorage, &nrf_fstorage_nvmc, NULL);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    if (m_crash.record.magic == CRASH_LOG_MAGIC)
+    {
+        record_log(&m_crash.record);
+
+        /* Saved from the fstorage events: erase, then write. */
+        m_saving = true;
+        if (nrf_fstorage_erase(&m_fstorage, PAGE_ADDR, 1, NULL) != NRF_SUCCESS)
+        {
+            m_saving = false;
+        }
+    }
+    if (!m_saving)
+    {
+        ring_reset();
+    }
+
+    backend_id = nrf_log_backend_add(&m_crash_log_backend, severity);
+    if (backend_id < 0)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    nrf_log_backend_enable(&m_crash_log_backend);
+
+    return NRF_SUCCESS;
+}
+
+static bool record_read(crash_log_record_t * p_rec)
+{
+    return (nrf_fstorage_read(&m_fstorage, PAGE_ADDR, p_rec, sizeof(*p_rec)) == NRF_SUCCESS) &&
+           (p_rec->magic == CRASH_LOG_MAGIC);
+}
+
+static void cmd_crashlog_show(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    crash_log_record_t rec;
+
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    if (!record_read(&rec))
+    {
+        nrf_cli_print(p_cli, "no crash saved");
+        return;
+    }
+
+    if (rec.reason == CRASH_LOG_REASON_APP_ERROR)
+    {
+        nrf_cli_print(p_cli, "app error: id 0x%08x, pc 0x%08x, info 0x%08x",
+                      rec.regs[0], rec.regs[1], rec.regs[2]);
+        nrf_cli_print(p_cli, "  error 0x%08x, line %u, file at 0x%08x",
+                      rec.regs[3], rec.regs[4], rec.regs[5]);
+    }
+    else
+    {
+        nrf_cli_print(p_cli, "hard fault at pc 0x%08x", rec.regs[6]);
+        nrf_cli_print(p_cli, "  R0:  0x%08x  R1:  0x%08x  R2:  0x%08x  R3:   0x%08x",
+                      rec.regs[0], rec.regs[1], rec.regs[2], rec.regs[3]);
+        nrf_cli_print(p_cli, "  R12: 0x%08x  LR:  0x%08x  PC:  0x%08x  xPSR: 0x%08x",
+                      rec.regs[4], rec.regs[5], rec.regs[6], rec.regs[7]);
+    }
+    nrf_cli_print(p_cli, "  CFSR: 0x%08x  HFSR: 0x%08x  MMFAR: 0x%08x  BFAR: 0x%08x",
+                  rec.cfsr, rec.hfsr, rec.mmfar, rec.bfar);
+    nrf_cli_print(p_cli, "captured in %u cycles", rec.capture_cycles);
+
+    if (rec.stack_words == 0)
+    {
+        nrf_cli_print(p_cli, "stack: invalid");
+    }
+    else
+    {
+        nrf_cli_print(p_cli, "stack at 0x%08x:", rec.sp);
+    }
+    for (uint32_t i = 0; i < MIN(rec.stack_words, CRASH_LOG_STACK_WORDS); i += 4)
+    {
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, " ");
+        for (uint32_t j = i; j < MIN(i + 4, rec.stack_words); j++)
+        {
+            nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, " %08x", rec.stack[j]);
+        }
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\n");
+    }
+
+    /* Oldest slot first, as one block for log_decode.py --hex. */
+    uint32_t cnt = MIN(rec.log_head, CRASH_LOG_ENTRIES);
+
+    nrf_cli_print(p_cli, "last %u log entries (decode with log_decode.py --hex):", cnt);
+    for (uint32_t i = rec.log_head - cnt; i != rec.log_head; i++)
+    {
+        uint8_t  slot[CRASH_LOG_ENTRY_SIZE];
+        uint32_t addr = PAGE_ADDR + offsetof(crash_log_t, ring) +
+                        ((i % CRASH_LOG_ENTRIES) * CRASH_LOG_ENTRY_SIZE);
+
+        if ((nrf_fstorage_read(&m_fstorage, addr, slot, sizeof(slot)) != NRF_SUCCESS) ||
+            (slot[0] >= CRASH_LOG_ENTRY_SIZE))
+        {
+            continue;
+        }
+        for (uint32_t j = 0; j <= slot[0]; j++)
+        {
+            nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "%02x", slot[j]);
+        }
+    }
+    nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\n");
+}
+
+static void cmd_crashlog_clear(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    if (m_saving || (nrf_fstorage_erase(&m_fstorage, PAGE_ADDR, 1, NULL) != NRF_SUCCESS))
+    {
+        nrf_cli_error(p_cli, "%s: flash busy, try again", argv[0]);
+    }
+}
+
+static void cmd_crashlog(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_crashlog)
+{
+    NRF_CLI_CMD(clear, NULL, "Erase the saved crash.", cmd_crashlog_clear),
+    NRF_CLI_CMD(show,  NULL, "Print the saved crash.", cmd_crashlog_show),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(crashlog, &m_sub_crashlog, "Crash captured before the last reset",
+                     cmd_crashlog);
+
+#endif // NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(CRASH_LOG)
@@ -0,0 +1,87 @@
+/** @file
+ * @defgroup crash_log Crash capture to no-init RAM
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Captures the crash context in RAM during a fault and saves it to flash after reset.
+ *
+ * The SDK crashlog backend enters logger panic mode in the fault handler, formats the pending and
+ * the buffered entries, and programs them to flash while the system is in an unknown state. This
+ * module does no formatting and no flash access in the fault path:
+ *
+ * - a logger backend keeps the last @ref CRASH_LOG_ENTRIES entries, encoded as binary frames
+ *   (@ref log_backend_bin_encode), in a ring located in the `.noinit` RAM section.
+ * - HardFault_c_handler() (replacing the one of hardfault_implementation.c) and
+ *   app_error_fault_handler() copy the stacked registers, the fault status registers and a
+ *   snippet of the stack next to the ring, mark the record valid and reset. Neither logs nor
+ *   flushes the logger: the panic flush would run the flash store backend.
+ *
+ * `.noinit` is a fixed region reserved at the top of RAM by linker.ld, below the bootloader stack
+ * and out of the application RAM. Neither the startup code nor the bootloader clears it, so the
+ * record survives the reset. On the next boot @ref crash_log_init logs the error the fault
+ * handler did not, saves the record to flash page @ref CRASH_LOG_FLASH_PAGE and invalidates it.
+ * Entries still waiting in the logger buffer at the time of the fault are lost.
+ *
+ * The `crashlog` CLI command prints the saved record. The log entries are printed as a hex line
+ * to be decoded with `apps/log/log_decode.py --hex`.
+ */
+#ifndef CRASH_LOG_H__
+#define CRASH_LOG_H__
+
+#include <stdint.h>
+
+#include "sdk_config.h"
+#include "sdk_errors.h"
+#include "nrf_log_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CRASH_LOG_MAGIC             0x48535243UL    //!< "CRSH", record valid.
+#define CRASH_LOG_ENTRY_SIZE        64              //!< Ring slot: length byte and frame.
+
+/**@brief Crash reasons. */
+typedef enum
+{
+    CRASH_LOG_REASON_HARDFAULT = 1, //!< Hard fault, registers stacked by the exception.
+    CRASH_LOG_REASON_APP_ERROR,     //!< app_error_fault_handler(), registers are id, pc, info.
+} crash_log_reason_t;
+
+/**@brief Crash record, followed in RAM and flash by the log ring. */
+typedef struct
+{
+    uint32_t magic;                             //!< @ref CRASH_LOG_MAGIC if valid.
+    uint32_t reason;                            //!< @ref crash_log_reason_t.
+    uint32_t regs[8];                           //!< R0-R3, R12, LR, PC, xPSR. For an app
+                                                //!< error: id, pc, info, error code, line and
+                                                //!< file name address.
+    uint32_t cfsr;                              //!< Configurable fault status.
+    uint32_t hfsr;                              //!< Hard fault status.
+    uint32_t mmfar;                             //!< MemManage fault address.
+    uint32_t bfar;                              //!< Bus fault address.
+    uint32_t sp;                                //!< Stack pointer, 0 if the stack was invalid.
+    uint32_t stack_words;                       //!< Valid words in stack.
+    uint32_t stack[CRASH_LOG_STACK_WORDS];      //!< Stack above the exception frame.
+    uint32_t capture_cycles;                    //!< CPU cycles spent in the capture.
+    uint32_t log_head;                          //!< Next ring slot to write.
+} crash_log_record_t;
+
+/**@brief Function for saving a crash captured before the reset, if any, and adding the ring
+ *        backend to the logger.
+ *
+ * @param[in] severity Highest severity level kept in the ring.
+ *
+ * @retval NRF_SUCCESS      Backend added.
+ * @retval NRF_ERROR_NO_MEM No free backend slot in the logger.
+ * @return Other errors from nrf_fstorage_init().
+ */
+ret_code_t crash_log_init(nrf_log_severity_t severity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CRASH_LOG_H__
+
+/** @} */
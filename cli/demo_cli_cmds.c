@@ -42,6 +42,8 @@
 #include "nrf_log.h"
 #include "sdk_common.h"
 #include "nrf_stack_guard.h"
+#include "app_timer.h"
+#include "telemetry.h"
 
 #define CLI_EXAMPLE_MAX_CMD_CNT (20u)
 #define CLI_EXAMPLE_MAX_CMD_LEN (33u)
@@ -52,15 +54,42 @@ static char m_dynamic_cmd_buffer[CLI_EXAMPLE_MAX_CMD_CNT][CLI_EXAMPLE_MAX_CMD_LE
 /* commands counter */
 static uint8_t m_dynamic_cmd_cnt;
 
-uint32_t m_counter;
-bool     m_counter_active = false;
+TELEMETRY_COUNTER_DEF(m_counter, "counter");
+bool m_counter_active = false;
+
+/* Counter timer. */
+APP_TIMER_DEF(m_counter_timer);
+
+static void counter_timer_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (m_counter_active)
+    {
+        telemetry_counter_inc(&m_counter);
+    }
+}
+
+/* Called by main(), after app_timer_init(). */
+ret_code_t demo_cli_counter_init(void)
+{
+    ret_code_t ret;
+
+    ret = app_timer_create(&m_counter_timer, APP_TIMER_MODE_REPEATED, counter_timer_handler);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    return app_timer_start(m_counter_timer, APP_TIMER_TICKS(1000), NULL);
+}
 
 /* Command handlers */
 static void cmd_print_param(nrf_cli_t const * p_cli, size_t argc, char **argv)
 {
     for (size_t i = 1; i < argc; i++)
     {
-        nrf_cli_print(p_cli, "argv[%d] = %s", i, argv[i]);
+        nrf_cli_print(p_cli, "argv[%u] = %s", (unsigned)i, argv[i]);
     }
 }
 
@@ -301,7 +330,7 @@ static void cmd_counter_reset(nrf_cli_t const * p_cli, size_t argc, char **argv)
         return;
     }
 
-    m_counter = 0;
+    telemetry_counter_reset(&m_counter);
 }
 
 static void cmd_counter(nrf_cli_t const * p_cli, size_t argc, char **argv)
@@ -388,8 +417,8 @@ void cli_example_stack_overflow_force(void)
     volatile char * p_tab = tab;
 
     /* This function accesses stack area protected by nrf_stack_guard. As a result
-       MPU (memory protection unit) triggers an exception (hardfault). Hardfault handler will log
-       exception reason.*/
+       MPU (memory protection unit) triggers an exception (hardfault). crash_log.c captures the
+       fault and resets, see the crashlog command.*/
     for (size_t idx = 0; idx < STACK_SIZE; idx++)
     {
         *(p_tab + idx) = (uint8_t)idx;
@@ -418,6 +447,9 @@ static double zero = 0.0;
 
 static void cmd_float_print(nrf_cli_t const * p_cli, size_t argc, char **argv)
 {
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+
     nrf_cli_print(p_cli, "%.10f", 0.0000000002);
     nrf_cli_print(p_cli, "%.10f", 153.0000000002);
     nrf_cli_print(p_cli, "%f", 0.0);
@@ -469,7 +501,7 @@ NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_counter)
 };
 NRF_CLI_CMD_REGISTER(counter,
                      &m_sub_counter,
-                     "Display seconds on terminal screen",
+                     "Count seconds, see 'telemetry show' and 'telemetry dump'",
                      cmd_counter);
 
 NRF_CLI_CMD_REGISTER(stack_overflow,
@@ -41,6 +41,8 @@
 #include "nrf_cli.h"
 #include "nrf_log.h"
 #include "sdk_common.h"
+#include "cli_typed_cmd.hpp"
+#include "telemetry.h"
 
 #define CLI_EXAMPLE_MAX_CMD_CNT (20u)
 #define CLI_EXAMPLE_MAX_CMD_LEN (33u)
@@ -48,6 +50,12 @@
 static char m_dynamic_cmd_buffer[CLI_EXAMPLE_MAX_CMD_CNT][CLI_EXAMPLE_MAX_CMD_LEN];
 static uint8_t m_dynamic_cmd_cnt;
 
+/* Defined in demo_cli_cmds.c. */
+extern "C" {
+TELEMETRY_COUNTER_DECLARE(m_counter);
+extern bool m_counter_active;
+}
+
 static void cmd_dynamic(nrf_cli_t const * p_cli, size_t argc, char **argv)
 {
     if ((argc == 1) || nrf_cli_help_requested(p_cli))
@@ -74,20 +82,8 @@ static int string_cmp(const void * p_a, const void * p_b)
     return strcmp((const char *)p_a, (const char *)p_b);
 }
 
-static void cmd_dynamic_add(nrf_cli_t const * p_cli, size_t argc, char **argv)
+static void cmd_dynamic_add(nrf_cli_t const * p_cli, char const * p_name)
 {
-    if (nrf_cli_help_requested(p_cli))
-    {
-        nrf_cli_help_print(p_cli, NULL, 0);
-        return;
-    }
-
-    if (argc != 2)
-    {
-        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
-        return;
-    }
-
     if (m_dynamic_cmd_cnt >= CLI_EXAMPLE_MAX_CMD_CNT)
     {
         nrf_cli_error(p_cli, "command limit reached");
@@ -95,7 +91,7 @@ static void cmd_dynamic_add(nrf_cli_t const * p_cli, size_t argc, char **argv)
     }
 
     uint8_t idx;
-    nrf_cli_cmd_len_t cmd_len = strlen(argv[1]);
+    nrf_cli_cmd_len_t cmd_len = strlen(p_name);
 
     if (cmd_len >= CLI_EXAMPLE_MAX_CMD_LEN)
     {
@@ -105,7 +101,7 @@ static void cmd_dynamic_add(nrf_cli_t const * p_cli, size_t argc, char **argv)
 
     for (idx = 0; idx < cmd_len; idx++)
     {
-        if (!isalnum((int)(argv[1][idx])))
+        if (!isalnum((int)(p_name[idx])))
         {
             nrf_cli_error(p_cli, "bad command name - please use only alphanumerical characters");
             return;
@@ -114,14 +110,14 @@ static void cmd_dynamic_add(nrf_cli_t const * p_cli, size_t argc, char **argv)
 
     for (idx = 0; idx < CLI_EXAMPLE_MAX_CMD_CNT; idx++)
     {
-        if (!strcmp(m_dynamic_cmd_buffer[idx], argv[1]))
+        if (!strcmp(m_dynamic_cmd_buffer[idx], p_name))
         {
             nrf_cli_error(p_cli, "duplicated command");
             return;
         }
     }
 
-    sprintf(m_dynamic_cmd_buffer[m_dynamic_cmd_cnt++], "%s", argv[1]);
+    sprintf(m_dynamic_cmd_buffer[m_dynamic_cmd_cnt++], "%s", p_name);
 
     qsort(m_dynamic_cmd_buffer,
           m_dynamic_cmd_cnt,
@@ -131,20 +127,8 @@ static void cmd_dynamic_add(nrf_cli_t const * p_cli, size_t argc, char **argv)
     nrf_cli_print(p_cli, "command added successfully");
 }
 
-static void cmd_dynamic_show(nrf_cli_t const * p_cli, size_t argc, char **argv)
+static void cmd_dynamic_show(nrf_cli_t const * p_cli)
 {
-    if (nrf_cli_help_requested(p_cli))
-    {
-        nrf_cli_help_print(p_cli, NULL, 0);
-        return;
-    }
-
-    if (argc != 1)
-    {
-        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
-        return;
-    }
-
     if (m_dynamic_cmd_cnt == 0)
     {
         nrf_cli_warn(p_cli, "Please add some commands first.");
@@ -157,48 +141,24 @@ static void cmd_dynamic_show(nrf_cli_t const * p_cli, size_t argc, char **argv)
     }
 }
 
-static void cmd_dynamic_execute(nrf_cli_t const * p_cli, size_t argc, char **argv)
+static void cmd_dynamic_execute(nrf_cli_t const * p_cli, char const * p_name)
 {
-    if (nrf_cli_help_requested(p_cli))
-    {
-        nrf_cli_help_print(p_cli, NULL, 0);
-        return;
-    }
-
-    if (argc != 2)
-    {
-        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
-        return;
-    }
-
     for (uint8_t idx = 0; idx <  m_dynamic_cmd_cnt; idx++)
     {
-        if (!strcmp(m_dynamic_cmd_buffer[idx], argv[1]))
+        if (!strcmp(m_dynamic_cmd_buffer[idx], p_name))
         {
-            nrf_cli_print(p_cli, "dynamic command: %s", argv[1]);
+            nrf_cli_print(p_cli, "dynamic command: %s", p_name);
             return;
         }
     }
-    nrf_cli_error(p_cli, "%s: uknown parameter: %s", argv[0], argv[1]);
+    nrf_cli_error(p_cli, "execute: uknown parameter: %s", p_name);
 }
 
-static void cmd_dynamic_remove(nrf_cli_t const * p_cli, size_t argc, char **argv)
+static void cmd_dynamic_remove(nrf_cli_t const * p_cli, char const * p_name)
 {
-    if ((argc == 1) || nrf_cli_help_requested(p_cli))
-    {
-        nrf_cli_help_print(p_cli, NULL, 0);
-        return;
-    }
-
-    if (argc != 2)
-    {
-        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
-        return;
-    }
-
     for (uint8_t idx = 0; idx <  m_dynamic_cmd_cnt; idx++)
     {
-        if (!strcmp(m_dynamic_cmd_buffer[idx], argv[1]))
+        if (!strcmp(m_dynamic_cmd_buffer[idx], p_name))
         {
             if (idx == CLI_EXAMPLE_MAX_CMD_CNT - 1)
             {
@@ -215,15 +175,53 @@ static void cmd_dynamic_remove(nrf_cli_t const * p_cli, size_t argc, char **argv
             return;
         }
     }
-    nrf_cli_error(p_cli, "did not find command: %s", argv[1]);
+    nrf_cli_error(p_cli, "did not find command: %s", p_name);
+}
+
+/* Typed counterpart of the 'counter' command: the action is parsed into an enum with a hash
+   lookup instead of a strcmp chain over the subcommands. */
+enum class counter_action { reset, start, stop };
+
+template <>
+struct cli::enum_traits<counter_action>
+{
+    static constexpr cli::enum_entry<counter_action> entries[] =
+    {
+        { "reset", counter_action::reset },
+        { "start", counter_action::start },
+        { "stop",  counter_action::stop  },
+    };
+};
+
+static void cmd_counter(nrf_cli_t const * p_cli, counter_action action)
+{
+    UNUSED_PARAMETER(p_cli);
+
+    switch (action)
+    {
+        case counter_action::reset:
+            telemetry_counter_reset(&m_counter);
+            break;
+        case counter_action::start:
+            m_counter_active = true;
+            break;
+        case counter_action::stop:
+            m_counter_active = false;
+            break;
+    }
 }
 
+NRF_CLI_CMD_REGISTER(cpp_counter,
+                     NULL,
+                     "Control the seconds counter: cpp_counter <reset|start|stop>.",
+                     cli::typed_handler<cmd_counter>::handler);
+
 /* Command handlers */
 static void cmd_print_param(nrf_cli_t const * p_cli, size_t argc, char **argv)
 {
     for (size_t i = 1; i < argc; i++)
     {
-        nrf_cli_print(p_cli, "argv[%d] = %s", i, argv[i]);
+        nrf_cli_print(p_cli, "argv[%u] = %s", (unsigned)i, argv[i]);
     }
 }
 
@@ -294,10 +292,13 @@ NRF_CLI_CPP_CREATE_STATIC_SUBCMD_SET(m_sub_dynamic,
         "a dynamic command 'test'.\nIn this example, command name length is limited to 32 chars. "
         "You can add up to 20 commands. Commands are automatically sorted to ensure correct "
         "CLI completion.",
-        cmd_dynamic_add),
-    NRF_CLI_CMD(execute, &m_sub_dynamic_set, "Execute a command.", cmd_dynamic_execute),
-    NRF_CLI_CMD(remove, &m_sub_dynamic_set, "Remove a command.", cmd_dynamic_remove),
-    NRF_CLI_CMD(show, NULL, "Show all added dynamic commands.", cmd_dynamic_show),
+        cli::typed_handler<cmd_dynamic_add>::handler),
+    NRF_CLI_CMD(execute, &m_sub_dynamic_set, "Execute a command.",
+        cli::typed_handler<cmd_dynamic_execute>::handler),
+    NRF_CLI_CMD(remove, &m_sub_dynamic_set, "Remove a command.",
+        cli::typed_handler<cmd_dynamic_remove>::handler),
+    NRF_CLI_CMD(show, NULL, "Show all added dynamic commands.",
+        cli::typed_handler<cmd_dynamic_show>::handler),
     NRF_CLI_SUBCMD_SET_END
 );
 
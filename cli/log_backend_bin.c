@@ -0,0 +1,290 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_LOG) && \
+    (NRF_MODULE_ENABLED(LOG_BACKEND_BIN) || NRF_MODULE_ENABLED(LOG_STORE))
+#include "log_backend_bin.h"
+
+#include <string.h>
+
+#include "nrf_log_ctrl.h"
+#include "nrf_log_internal.h"
+#include "nrf_memobj.h"
+
+/* Strings located below this address are part of the image and are resolved by the decoder. */
+#define RAM_START               0x20000000UL
+
+STATIC_ASSERT(NRF_LOG_MAX_NUM_OF_ARGS < 8);
+
+typedef struct
+{
+    uint8_t * p_buf;
+    size_t    size;
+    size_t    len;
+} frame_t;
+
+static size_t frame_space(frame_t const * p_frame)
+{
+    return p_frame->size - p_frame->len;
+}
+
+static void frame_varint_put(frame_t * p_frame, uint32_t value)
+{
+    do
+    {
+        uint8_t byte = value & 0x7F;
+
+        value >>= 7;
+        if (value != 0)
+        {
+            byte |= 0x80;
+        }
+        if (p_frame->len < p_frame->size)
+        {
+            p_frame->p_buf[p_frame->len++] = byte;
+        }
+    } while (value != 0);
+}
+
+static void frame_string_put(frame_t * p_frame, char const * p_str)
+{
+    size_t len = (p_str != NULL) ? strlen(p_str) : 0;
+
+    /* Marker for an inlined string, followed by its length. */
+    frame_varint_put(p_frame, 0);
+    len = MIN(len, UINT8_MAX);
+    len = MIN(len, (frame_space(p_frame) > 0) ? (frame_space(p_frame) - 1) : 0);
+    frame_varint_put(p_frame, len);
+    memcpy(&p_frame->p_buf[p_frame->len], p_str, len);
+    p_frame->len += len;
+}
+
+/* Returns the mask of arguments consumed by %s conversions. Only those need special handling,
+   everything else is sent as a raw word. */
+static uint32_t string_args_get(char const * p_fmt)
+{
+    uint32_t mask = 0;
+    uint32_t arg  = 0;
+
+    while (*p_fmt != '\0')
+    {
+        if (*p_fmt++ != '%')
+        {
+            continue;
+        }
+        if (*p_fmt == '%')
+        {
+            p_fmt++;
+            continue;
+        }
+        while ((*p_fmt != '\0') && (strchr("-+ #0123456789.*hlzjtL", *p_fmt) != NULL))
+        {
+            if (*p_fmt == '*')
+            {
+                arg++;
+            }
+            p_fmt++;
+        }
+        if (*p_fmt == '\0')
+        {
+            break;
+        }
+        if (*p_fmt++ == 's')
+        {
+            mask |= (1UL << arg);
+        }
+        arg++;
+    }
+
+    return mask;
+}
+
+size_t log_backend_bin_encode(log_backend_bin_enc_t * p_enc,
+                              nrf_log_entry_t *       p_msg,
+                              uint8_t *               p_buf,
+                              size_t                  size)
+{
+    nrf_log_header_t header;
+    size_t           offset = HEADER_SIZE * sizeof(uint32_t);
+    frame_t          frame  = { .p_buf = p_buf, .size = size, .len = 1 };
+
+    nrf_memobj_read(p_msg, &header, HEADER_SIZE * sizeof(uint32_t), 0);
+
+#if NRF_LOG_USES_TIMESTAMP
+    uint32_t timestamp = header.timestamp;
+#else
+    uint32_t timestamp = 0;
+#endif
+    bool     absolute  = ((p_enc->frame_cnt++ % LOG_BACKEND_BIN_SYNC_INTERVAL) == 0);
+    uint8_t  flags     = header.base.std.severity;
+
+    if (absolute)
+    {
+        flags |= LOG_BACKEND_BIN_FLAG_ABS_TIME;
+    }
+    if (header.dropped != 0)
+    {
+        flags |= LOG_BACKEND_BIN_FLAG_DROPPED;
+    }
+    if (header.base.generic.type == HEADER_TYPE_HEXDUMP)
+    {
+        flags |= LOG_BACKEND_BIN_FLAG_HEXDUMP;
+    }
+
+    p_buf[0] = flags;
+    frame_varint_put(&frame, header.module_id);
+    frame_varint_put(&frame, absolute ? timestamp : (timestamp - p_enc->last_timestamp));
+    p_enc->last_timestamp = timestamp;
+    if (header.dropped != 0)
+    {
+        frame_varint_put(&frame, header.dropped);
+    }
+
+    if (header.base.generic.type == HEADER_TYPE_STD)
+    {
+        char const * p_fmt = (char const *)((uint32_t)header.base.std.addr);
+        uint32_t     nargs = header.base.std.nargs;
+        uint32_t     strings = string_args_get(p_fmt);
+        uint32_t     args[NRF_LOG_MAX_NUM_OF_ARGS];
+
+        nrf_memobj_read(p_msg, args, nargs * sizeof(uint32_t), offset);
+
+        frame_varint_put(&frame, ((uint32_t)p_fmt << 3) | nargs);
+        for (uint32_t i = 0; i < nargs; i++)
+        {
+            if ((strings & (1UL << i)) && ((args[i] >= RAM_START) || (args[i] == 0)))
+            {
+                frame_string_put(&frame, (char const *)args[i]);
+            }
+            else
+            {
+                frame_varint_put(&frame, args[i]);
+            }
+        }
+    }
+    else if (header.base.generic.type == HEADER_TYPE_HEXDUMP)
+    {
+        /* Two bytes for the length, longer dumps are truncated to the frame. */
+        size_t len = header.base.hexdump.len;
+
+        len = MIN(len, (frame_space(&frame) > 2) ? (frame_space(&frame) - 2) : 0);
+        frame_varint_put(&frame, len);
+        nrf_memobj_read(p_msg, &p_buf[frame.len], len, offset);
+        frame.len += len;
+    }
+
+    return frame.len;
+}
+
+#if NRF_MODULE_ENABLED(LOG_BACKEND_BIN)
+#include "SEGGER_RTT.h"
+
+/* COBS adds one byte per 254 bytes of data, plus the leading code and the delimiter. */
+#define COBS_BUF_SIZE           (LOG_BACKEND_BIN_FRAME_SIZE + (LOG_BACKEND_BIN_FRAME_SIZE / 254) + 2)
+
+NRF_LOG_BACKEND_DEF(m_log_backend_bin, log_backend_bin_api, NULL);
+
+static char const m_marker[] = LOG_BACKEND_BIN_MARKER;
+
+static uint8_t  m_rtt_buf[LOG_BACKEND_BIN_RTT_BUFFER_SIZE];
+static uint8_t  m_frame[LOG_BACKEND_BIN_FRAME_SIZE];
+static uint8_t  m_cobs[COBS_BUF_SIZE];
+
+static log_backend_bin_enc_t m_enc;
+
+static size_t cobs_encode(uint8_t const * p_src, size_t len, uint8_t * p_dst)
+{
+    size_t  code_idx = 0;
+    size_t  out      = 1;
+    uint8_t code     = 1;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        if (p_src[i] != 0)
+        {
+            p_dst[out++] = p_src[i];
+            code++;
+        }
+        if ((p_src[i] == 0) || (code == 0xFF))
+        {
+            p_dst[code_idx] = code;
+            code_idx        = out++;
+            code            = 1;
+        }
+    }
+    p_dst[code_idx] = code;
+    p_dst[out++]    = 0;
+
+    return out;
+}
+
+static void frame_send(size_t frame_len)
+{
+    size_t len = cobs_encode(m_frame, frame_len, m_cobs);
+
+    /* The channel runs in skip mode, a frame is either written completely or not at all. After a
+       lost frame the next timestamp must be absolute. */
+    if (SEGGER_RTT_Write(LOG_BACKEND_BIN_RTT_CHANNEL, m_cobs, len) != len)
+    {
+        m_enc.frame_cnt = 0;
+    }
+}
+
+static void log_backend_bin_put(nrf_log_backend_t const * p_backend, nrf_log_entry_t * p_msg)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    nrf_memobj_get(p_msg);
+    size_t len = log_backend_bin_encode(&m_enc, p_msg, m_frame, sizeof(m_frame));
+    nrf_memobj_put(p_msg);
+
+    frame_send(len);
+}
+
+static void log_backend_bin_flush(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+}
+
+static void log_backend_bin_panic_set(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+}
+
+const nrf_log_backend_api_t log_backend_bin_api =
+{
+    .put       = log_backend_bin_put,
+    .flush     = log_backend_bin_flush,
+    .panic_set = log_backend_bin_panic_set,
+};
+
+ret_code_t log_backend_bin_init(nrf_log_severity_t severity)
+{
+    int32_t backend_id;
+
+    if (SEGGER_RTT_ConfigUpBuffer(LOG_BACKEND_BIN_RTT_CHANNEL,
+                                  "BinLog",
+                                  m_rtt_buf,
+                                  sizeof(m_rtt_buf),
+                                  SEGGER_RTT_MODE_NO_BLOCK_SKIP) < 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    backend_id = nrf_log_backend_add(&m_log_backend_bin, severity);
+    if (backend_id < 0)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    frame_t session = { .p_buf = m_frame, .size = sizeof(m_frame), .len = 1 };
+
+    m_frame[0] = LOG_BACKEND_BIN_FRAME_SESSION;
+    frame_varint_put(&session, (uint32_t)m_marker);
+    frame_send(session.len);
+
+    nrf_log_backend_enable(&m_log_backend_bin);
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(LOG_BACKEND_BIN)
+#endif // NRF_MODULE_ENABLED(NRF_LOG) && (LOG_BACKEND_BIN || LOG_STORE)
@@ -0,0 +1,93 @@
+/** @file
+ * @defgroup log_backend_bin Binary logger backend
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief nrf_log backend that sends log entries without formatting them.
+ *
+ * The deferred logger already stores a log entry as the address of its format string followed by
+ * the raw arguments. This backend forwards that representation to an RTT up channel instead of
+ * formatting it on the device, so an entry costs a few bytes on the wire and the log buffer is
+ * drained much faster than by the string backends. The strings themselves never leave the
+ * device: `apps/log/log_decode.py` reads them from the ELF file of the running image.
+ *
+ * The logger passes every entry to every backend. The gain is only there when no string backend
+ * is left next to this one, so with LOG_BACKEND_BIN_ENABLED the cli app does not add the log
+ * backends of its CLI instances: the logs no longer show up on the consoles. It is disabled by
+ * default in sdk_config.h for that reason.
+ *
+ * Every entry is sent as one COBS encoded frame terminated by a zero byte:
+ *
+ * - flags (byte): bits 0-2 severity, @ref LOG_BACKEND_BIN_FLAG_HEXDUMP and the other flags.
+ * - module (varint): module ID, index in the log_const_data section.
+ * - timestamp (varint): relative to the previous frame unless flagged absolute.
+ * - dropped (varint): number of dropped entries, present only if flagged.
+ * - standard entry: varint (format string address << 3 | nargs), then one varint per argument.
+ *   `%s` arguments pointing to RAM are sent as 0, the length (varint) and the characters.
+ * - hexdump entry: varint length followed by the data.
+ *
+ * A session frame (flags @ref LOG_BACKEND_BIN_FRAME_SESSION) is sent first, carrying the address
+ * of a marker string, so that the decoder can check that it uses the ELF file of the running
+ * image.
+ */
+#ifndef LOG_BACKEND_BIN_H__
+#define LOG_BACKEND_BIN_H__
+
+#include "sdk_errors.h"
+#include "nrf_log_backend_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOG_BACKEND_BIN_FLAG_HEXDUMP    0x08 //!< Frame carries a hexdump entry.
+#define LOG_BACKEND_BIN_FLAG_ABS_TIME   0x10 //!< Timestamp is absolute.
+#define LOG_BACKEND_BIN_FLAG_DROPPED    0x20 //!< Dropped entries count follows the timestamp.
+#define LOG_BACKEND_BIN_FRAME_SESSION   0xC0 //!< Session frame, followed by the marker address.
+
+#define LOG_BACKEND_BIN_MARKER          "nrf_log binary v1" //!< Marker string of session frame.
+
+/**@brief Frame encoder state, for the delta encoding of the timestamps. */
+typedef struct
+{
+    uint32_t frame_cnt;         //!< Frames encoded, 0 forces an absolute timestamp.
+    uint32_t last_timestamp;    //!< Timestamp of the previous frame.
+} log_backend_bin_enc_t;
+
+extern const nrf_log_backend_api_t log_backend_bin_api;
+
+/**@brief Function for encoding a log entry into a frame, before COBS encoding.
+ *
+ * Used by the RTT backend and by other backends storing the same representation, see
+ * @ref log_backend_store. The caller holds a reference to the entry.
+ *
+ * @param[in,out] p_enc Encoder state.
+ * @param[in]     p_msg Log entry.
+ * @param[out]    p_buf Frame buffer. Arguments and hexdump data not fitting are truncated.
+ * @param[in]     size  Frame buffer size.
+ *
+ * @return Frame length.
+ */
+size_t log_backend_bin_encode(log_backend_bin_enc_t * p_enc,
+                              nrf_log_entry_t *       p_msg,
+                              uint8_t *               p_buf,
+                              size_t                  size);
+
+/**@brief Function for initializing the RTT channel, adding the backend to the logger and
+ *        enabling it.
+ *
+ * @param[in] severity Highest severity level passed to the backend.
+ *
+ * @retval NRF_SUCCESS             Backend added.
+ * @retval NRF_ERROR_NO_MEM        No free backend slot in the logger.
+ * @retval NRF_ERROR_INVALID_PARAM The RTT channel is not available.
+ */
+ret_code_t log_backend_bin_init(nrf_log_severity_t severity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_BACKEND_BIN_H__
+
+/** @} */
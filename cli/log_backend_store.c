@@ -0,0 +1,257 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(LOG_STORE)
+#include "log_backend_store.h"
+
+#include "log_backend_bin.h"
+#include "log_store.h"
+#include "nrf_fstorage.h"
+#include "nrf_fstorage_nvmc.h"
+#include "nrf_log_ctrl.h"
+#include "nrf_memobj.h"
+#include "nrf_cli.h"
+
+#define PAGE_SIZE       0x1000
+#define START_ADDR      (LOG_STORE_START_PAGE * PAGE_SIZE)
+#define END_ADDR        (START_ADDR + (LOG_STORE_PAGES * PAGE_SIZE))
+
+/* Frames are at most LOG_BACKEND_BIN_FRAME_SIZE bytes, their length fits in a 2 byte varint. */
+#define LEN_SIZE_MAX    2
+
+STATIC_ASSERT(LOG_BACKEND_BIN_FRAME_SIZE < 0x4000);
+STATIC_ASSERT(LOG_STORE_PAGES >= 2);
+STATIC_ASSERT(LOG_STORE_OUT_SIZE(LOG_STORE_BLOCK_SIZE) <= (PAGE_SIZE - LOG_STORE_PAGE_HDR_SIZE));
+
+static void fstorage_evt_handler(nrf_fstorage_evt_t * p_evt);
+
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_fstorage) =
+{
+    .evt_handler = fstorage_evt_handler,
+    .start_addr  = START_ADDR,
+    .end_addr    = END_ADDR,
+};
+
+NRF_LOG_BACKEND_DEF(m_log_backend_store, log_backend_store_api, NULL);
+
+LOG_STORE_DEF(m_store, LOG_STORE_BLOCK_SIZE);
+
+static log_backend_bin_enc_t m_enc;
+static uint8_t               m_frame[LEN_SIZE_MAX + LOG_BACKEND_BIN_FRAME_SIZE];
+
+static bool flash_read(void * p_context, uint32_t addr, void * p_dst, uint32_t len)
+{
+    return (nrf_fstorage_read(p_context, addr, p_dst, len) == NRF_SUCCESS);
+}
+
+static bool flash_write(void * p_context, uint32_t addr, void const * p_src, uint32_t len)
+{
+    return (nrf_fstorage_write(p_context, addr, p_src, len, NULL) == NRF_SUCCESS);
+}
+
+static bool flash_erase(void * p_context, uint32_t page_addr)
+{
+    return (nrf_fstorage_erase(p_context, page_addr, 1, NULL) == NRF_SUCCESS);
+}
+
+static const log_store_flash_api_t m_flash_api =
+{
+    .read  = flash_read,
+    .write = flash_write,
+    .erase = flash_erase,
+};
+
+static void fstorage_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    log_store_flash_evt(&m_store, (p_evt->result == NRF_SUCCESS));
+}
+
+static void log_backend_store_put(nrf_log_backend_t const * p_backend, nrf_log_entry_t * p_msg)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    /* Flush before encoding, so that the first frame of a block carries an absolute
+       timestamp. */
+    if (log_store_block_space(&m_store) < sizeof(m_frame))
+    {
+        log_store_flush(&m_store);
+    }
+    if (log_store_block_is_empty(&m_store))
+    {
+        m_enc.frame_cnt = 0;
+    }
+
+    nrf_memobj_get(p_msg);
+    size_t len = log_backend_bin_encode(&m_enc, p_msg,
+                                        &m_frame[LEN_SIZE_MAX], LOG_BACKEND_BIN_FRAME_SIZE);
+    nrf_memobj_put(p_msg);
+
+    /* Varint length in front of the frame. */
+    size_t start = LEN_SIZE_MAX;
+
+    if (len >= 0x80)
+    {
+        m_frame[--start] = (uint8_t)(len >> 7);
+        m_frame[--start] = (uint8_t)(len | 0x80);
+    }
+    else
+    {
+        m_frame[--start] = (uint8_t)len;
+    }
+
+    /* Dropped only if the previous block is still being programmed, counted by the store. */
+    UNUSED_RETURN_VALUE(log_store_append(&m_store, &m_frame[start], LEN_SIZE_MAX + len - start));
+}
+
+static void log_backend_store_flush(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    log_store_flush(&m_store);
+}
+
+static void log_backend_store_panic_set(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    log_store_flush(&m_store);
+}
+
+const nrf_log_backend_api_t log_backend_store_api =
+{
+    .put       = log_backend_store_put,
+    .flush     = log_backend_store_flush,
+    .panic_set = log_backend_store_panic_set,
+};
+
+ret_code_t log_backend_store_init(nrf_log_severity_t severity)
+{
+    ret_code_t ret;
+    int32_t    backend_id;
+
+    ret = nrf_fstorage_init(&m_fstorage, &nrf_fstorage_nvmc, NULL);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    log_store_init(&m_store, &m_flash_api, &m_fstorage, START_ADDR, PAGE_SIZE, LOG_STORE_PAGES);
+
+    backend_id = nrf_log_backend_add(&m_log_backend_store, severity);
+    if (backend_id < 0)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    nrf_log_backend_enable(&m_log_backend_store);
+
+    return NRF_SUCCESS;
+}
+
+static void block_print(void * p_context, uint8_t const * p_data, size_t len)
+{
+    nrf_cli_t const * p_cli = p_context;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "%02x", p_data[i]);
+    }
+    nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\n");
+}
+
+static bool cmd_check(nrf_cli_t const * p_cli, size_t argc, char ** argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return false;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return false;
+    }
+
+    return true;
+}
+
+static void cmd_logstore_stats(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (!cmd_check(p_cli, argc, argv))
+    {
+        return;
+    }
+
+    log_store_stats_t const * p_stats = &m_store.stats;
+    uint32_t                  ratio   = (p_stats->raw_bytes != 0) ?
+                                        (p_stats->stored_bytes * 100) / p_stats->raw_bytes : 0;
+
+    nrf_cli_print(p_cli, "pages: %u at 0x%08x, writing page %u offset %u, sequence %u",
+                  LOG_STORE_PAGES, START_ADDR,
+                  m_store.page_idx, m_store.page_offset, m_store.seq);
+    nrf_cli_print(p_cli, "block: %u/%u bytes", m_store.block_len, m_store.block_size);
+    nrf_cli_print(p_cli, "since boot: %u bytes stored as %u (%u%%), %u blocks, %u erases",
+                  p_stats->raw_bytes,
+                  p_stats->stored_bytes,
+                  ratio,
+                  p_stats->blocks,
+                  p_stats->erases);
+    nrf_cli_print(p_cli, "dropped: %u, flash errors: %u", p_stats->dropped, p_stats->errors);
+}
+
+static void cmd_logstore_flush(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (!cmd_check(p_cli, argc, argv))
+    {
+        return;
+    }
+
+    log_store_flush(&m_store);
+}
+
+static void cmd_logstore_clear(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (!cmd_check(p_cli, argc, argv))
+    {
+        return;
+    }
+
+    log_store_clear(&m_store);
+}
+
+static void cmd_logstore_dump(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (!cmd_check(p_cli, argc, argv))
+    {
+        return;
+    }
+
+    log_store_flush(&m_store);
+    if (!log_store_read(&m_store, block_print, (void *)p_cli))
+    {
+        nrf_cli_error(p_cli, "%s: flash busy, try again", argv[0]);
+    }
+}
+
+static void cmd_logstore(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_logstore)
+{
+    NRF_CLI_CMD(clear, NULL, "Erase the stored logs.", cmd_logstore_clear),
+    NRF_CLI_CMD(dump,  NULL, "Print the stored blocks as hex, oldest first. "
+                "Decode with log_decode.py --hex.", cmd_logstore_dump),
+    NRF_CLI_CMD(flush, NULL, "Program the current block.", cmd_logstore_flush),
+    NRF_CLI_CMD(stats, NULL, "Show the store statistics.", cmd_logstore_stats),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(logstore, &m_sub_logstore, "Compressed flash log store", cmd_logstore);
+
+#endif // NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(LOG_STORE)
@@ -0,0 +1,50 @@
+/** @file
+ * @defgroup log_backend_store Compressed flash logger backend
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief nrf_log backend keeping the log history in a range of flash pages.
+ *
+ * Replaces the SDK flashlog backend, which programs every entry as its own serialized record and
+ * fits a single page. Entries are encoded as binary frames (@ref log_backend_bin_encode) and
+ * collected in a RAM block of @ref LOG_STORE_BLOCK_SIZE bytes, each frame prefixed with its
+ * varint length. A full block is compressed and programmed at once by @ref log_store, which
+ * rotates over @ref LOG_STORE_PAGES pages starting at page @ref LOG_STORE_START_PAGE. The encoder
+ * restarts with every block, so each block decodes on its own.
+ *
+ * The block is also flushed when the logger is flushed or enters panic mode. Flash is accessed
+ * through nrf_fstorage with the NVMC backend, so the operations complete synchronously.
+ *
+ * The `logstore` CLI command shows statistics, clears the pages and dumps the blocks as hex
+ * lines, to be decoded with `apps/log/log_decode.py --hex`.
+ */
+#ifndef LOG_BACKEND_STORE_H__
+#define LOG_BACKEND_STORE_H__
+
+#include "sdk_errors.h"
+#include "nrf_log_backend_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const nrf_log_backend_api_t log_backend_store_api;
+
+/**@brief Function for initializing the flash store, adding the backend to the logger and
+ *        enabling it.
+ *
+ * @param[in] severity Highest severity level passed to the backend.
+ *
+ * @retval NRF_SUCCESS      Backend added.
+ * @retval NRF_ERROR_NO_MEM No free backend slot in the logger.
+ * @return Other errors from nrf_fstorage_init().
+ */
+ret_code_t log_backend_store_init(nrf_log_severity_t severity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_BACKEND_STORE_H__
+
+/** @} */
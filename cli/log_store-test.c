@@ -0,0 +1,370 @@
+/* Host test of the compressed log store.
+ *
+ * Build and run on the host:
+ *   gcc -O2 -o log_store-test log_store-test.c log_store.c lzss.c && ./log_store-test
+ *
+ * The flash is simulated in RAM with the NVMC rules: erase sets a page to 0xFF, writes are word
+ * aligned and can only clear bits. Log lines typical of the CLI example are stored until the
+ * page range wraps, the store is reinitialized as after a reset and the content is read back.
+ * Flash operations that cannot be started must be retried later, not skip pages.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "log_store.h"
+
+#define TEST_PAGE_SIZE    4096u
+#define TEST_PAGE_CNT     4u
+#define TEST_START_ADDR   0xD9000u
+#define TEST_BLOCK_SIZE   2048u
+
+static uint8_t  m_flash[TEST_PAGE_SIZE * TEST_PAGE_CNT];
+static unsigned m_erases;
+static unsigned m_writes;
+static unsigned m_fails;
+static bool     m_async;        /* Complete operations from test_flash_complete(). */
+static bool     m_pending;
+static bool     m_queue_full;   /* Operations fail to start, as with a full fstorage queue. */
+static unsigned m_rejected;
+
+LOG_STORE_DEF(m_store, TEST_BLOCK_SIZE);
+
+static void check(bool cond, char const * p_what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", p_what);
+        m_fails++;
+    }
+}
+
+static uint8_t * flash_ptr(uint32_t addr, uint32_t len)
+{
+    if ((addr < TEST_START_ADDR) || ((addr + len) > (TEST_START_ADDR + sizeof(m_flash))))
+    {
+        return NULL;
+    }
+    return &m_flash[addr - TEST_START_ADDR];
+}
+
+static void flash_done(void)
+{
+    if (m_async)
+    {
+        m_pending = true;
+    }
+    else
+    {
+        log_store_flash_evt(&m_store, true);
+    }
+}
+
+static bool flash_read(void * p_context, uint32_t addr, void * p_dst, uint32_t len)
+{
+    uint8_t * p_flash = flash_ptr(addr, len);
+
+    (void)p_context;
+    if (p_flash == NULL)
+    {
+        return false;
+    }
+    memcpy(p_dst, p_flash, len);
+    return true;
+}
+
+static bool flash_write(void * p_context, uint32_t addr, void const * p_src, uint32_t len)
+{
+    uint8_t *       p_flash = flash_ptr(addr, len);
+    uint8_t const * p_data  = p_src;
+
+    (void)p_context;
+    check(!m_pending, "one operation at a time");
+    check(((addr | len) & 3u) == 0, "word aligned write");
+    if (m_queue_full)
+    {
+        m_rejected++;
+        return false;
+    }
+    if (p_flash == NULL)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < len; i++)
+    {
+        check((p_data[i] & ~p_flash[i]) == 0, "write only clears bits");
+        p_flash[i] &= p_data[i];
+    }
+    m_writes++;
+    flash_done();
+    return true;
+}
+
+static bool flash_erase(void * p_context, uint32_t page_addr)
+{
+    uint8_t * p_flash = flash_ptr(page_addr, TEST_PAGE_SIZE);
+
+    (void)p_context;
+    check(!m_pending, "one operation at a time");
+    check(((page_addr - TEST_START_ADDR) % TEST_PAGE_SIZE) == 0, "page aligned erase");
+    if (m_queue_full)
+    {
+        m_rejected++;
+        return false;
+    }
+    if (p_flash == NULL)
+    {
+        return false;
+    }
+    memset(p_flash, 0xFF, TEST_PAGE_SIZE);
+    m_erases++;
+    flash_done();
+    return true;
+}
+
+static const log_store_flash_api_t m_flash_api =
+{
+    .read  = flash_read,
+    .write = flash_write,
+    .erase = flash_erase,
+};
+
+static void test_flash_complete(void)
+{
+    while (m_pending)
+    {
+        m_pending = false;
+        log_store_flash_evt(&m_store, true);
+    }
+}
+
+static void store_init(void)
+{
+    log_store_init(&m_store, &m_flash_api, NULL, TEST_START_ADDR, TEST_PAGE_SIZE, TEST_PAGE_CNT);
+}
+
+/* Record layout used by the test: 16-bit line number, then the text. */
+static size_t line_make(uint8_t * p_buf, unsigned line)
+{
+    static char const * const fmt[] =
+    {
+        "<info> app: Counter value: %u",
+        "<debug> cli: command executed: counter start",
+        "<warning> app: Battery voltage %u mV below threshold",
+        "<info> usbd_cdc: rx %u bytes",
+    };
+
+    p_buf[0] = (uint8_t)line;
+    p_buf[1] = (uint8_t)(line >> 8);
+    return 2 + (size_t)sprintf((char *)&p_buf[2], fmt[line % 4], line * 7u);
+}
+
+static unsigned m_read_first;
+static unsigned m_read_next;
+static unsigned m_read_lines;
+static bool     m_read_ordered;
+
+static void read_handler(void * p_context, uint8_t const * p_data, size_t len)
+{
+    (void)p_context;
+    size_t pos = 0;
+
+    while (pos < len)
+    {
+        uint8_t  expected[64];
+        unsigned line    = p_data[pos] | (p_data[pos + 1] << 8);
+        size_t   rec_len = line_make(expected, line);
+
+        if (m_read_lines == 0)
+        {
+            m_read_first = line;
+        }
+        else if (line != m_read_next)
+        {
+            m_read_ordered = false;
+        }
+        if (((pos + rec_len) > len) || memcmp(&p_data[pos], expected, rec_len))
+        {
+            m_read_ordered = false;
+            return;
+        }
+        m_read_next = line + 1;
+        m_read_lines++;
+        pos += rec_len;
+    }
+}
+
+static void read_all(void)
+{
+    m_read_lines   = 0;
+    m_read_ordered = true;
+    check(log_store_read(&m_store, read_handler, NULL), "store readable");
+}
+
+static unsigned store_lines(unsigned first, unsigned count)
+{
+    uint8_t  buf[64];
+    unsigned stored = 0;
+
+    for (unsigned line = first; line < first + count; line++)
+    {
+        size_t len = line_make(buf, line);
+
+        stored += log_store_append(&m_store, buf, len) ? 1 : 0;
+        test_flash_complete();
+    }
+    log_store_flush(&m_store);
+    test_flash_complete();
+    return stored;
+}
+
+static void test_empty(void)
+{
+    memset(m_flash, 0xFF, sizeof(m_flash));
+    store_init();
+    read_all();
+    check(m_read_lines == 0, "erased flash is empty");
+
+    store_lines(0, 10);
+    read_all();
+    check((m_read_lines == 10) && m_read_ordered, "lines read back");
+    check(m_erases == 1, "first page erased once");
+}
+
+static void test_wrap(void)
+{
+    unsigned const count = 40000;
+
+    m_erases = 0;
+    m_writes = 0;
+    store_lines(10, count);
+
+    log_store_stats_t const * p_stats = &m_store.stats;
+
+    read_all();
+    check(m_read_ordered, "lines in order after wrap");
+    check(m_read_next == 10 + count, "newest line kept");
+    check(m_read_first > 10, "oldest lines dropped");
+    check(m_read_lines < count, "history bounded by the page range");
+
+    unsigned const cycles = m_erases / TEST_PAGE_CNT;
+
+    printf("%u lines, %u raw bytes stored as %u flash bytes (%.1f%%)\r\n",
+           count,
+           (unsigned)p_stats->raw_bytes,
+           (unsigned)p_stats->stored_bytes,
+           100.0 * p_stats->stored_bytes / p_stats->raw_bytes);
+    printf("%u blocks, %u writes, %u erases (%u per page), %u lines retained\r\n",
+           (unsigned)p_stats->blocks, m_writes, m_erases, cycles, m_read_lines);
+    check(p_stats->stored_bytes * 2 < p_stats->raw_bytes, "compression at least 2:1");
+    check(p_stats->dropped == 0 && p_stats->errors == 0, "no drops or errors");
+}
+
+static void test_reinit(void)
+{
+    unsigned const last = m_read_next;
+
+    /* Reset: the write position is found again, new lines follow the old ones. */
+    store_init();
+    read_all();
+    check(m_read_next == last, "content kept over reinit");
+
+    store_lines(last, 100);
+    read_all();
+    check(m_read_ordered && (m_read_next == last + 100), "append after reinit");
+
+    /* Corrupt one byte of the newest record: it is skipped, the rest is still read. */
+    uint32_t offset = m_store.page_offset;
+    uint32_t hdr    = 0;
+    uint32_t prev   = LOG_STORE_PAGE_HDR_SIZE;
+
+    while (prev + LOG_STORE_REC_HDR_SIZE < offset)
+    {
+        hdr = prev;
+        prev += (LOG_STORE_REC_HDR_SIZE + (m_flash[m_store.page_idx * TEST_PAGE_SIZE + prev] |
+                 (m_flash[m_store.page_idx * TEST_PAGE_SIZE + prev + 1] << 8)) + 3) & ~3u;
+    }
+    m_flash[m_store.page_idx * TEST_PAGE_SIZE + hdr + LOG_STORE_REC_HDR_SIZE + 1] ^= 0x01;
+    read_all();
+    check(m_read_next < last + 100, "corrupted record skipped");
+    check(m_read_lines > 0, "older records still read");
+}
+
+static void test_async(void)
+{
+    uint8_t buf[64];
+    size_t  len = line_make(buf, 0);
+
+    /* Fill a block and keep its write pending: the next block is buffered, the one after is
+       dropped. */
+    memset(m_flash, 0xFF, sizeof(m_flash));
+    store_init();
+    m_async = true;
+
+    while (log_store_append(&m_store, buf, len)) { }
+    check(m_store.stats.dropped == 1, "drop while the previous block is pending");
+    check(log_store_is_busy(&m_store), "busy while the write is pending");
+    check(!log_store_read(&m_store, read_handler, NULL), "no read while busy");
+    test_flash_complete();
+    log_store_flush(&m_store);
+    test_flash_complete();
+    check(!log_store_is_busy(&m_store), "idle after completion");
+    check(m_store.stats.blocks == 2, "both blocks programmed");
+
+    log_store_clear(&m_store);
+    check(log_store_is_busy(&m_store), "busy while clearing");
+    test_flash_complete();
+    m_async = false;
+    read_all();
+    check(m_read_lines == 0, "empty after clear");
+}
+
+static void test_queue_full(void)
+{
+    uint8_t  buf[64];
+    size_t   len = line_make(buf, 0);
+    unsigned lines;
+
+    memset(m_flash, 0xFF, sizeof(m_flash));
+    store_init();
+    m_erases   = 0;
+    m_rejected = 0;
+
+    /* The first page needs an erase which cannot be started: one attempt per flush, no page is
+       skipped and the block stays pending. Two blocks are filled, the appends flush both. */
+    m_queue_full = true;
+    for (lines = 0; log_store_append(&m_store, buf, len); lines++) { }
+    log_store_flush(&m_store);
+    check(m_rejected == 3, "one erase attempt per flush");
+    check((m_store.page_idx == 0) && (m_store.page_offset == 0), "no page skipped");
+    check(log_store_is_busy(&m_store), "block still pending");
+
+    m_queue_full = false;
+    log_store_flush(&m_store);
+    check(m_erases == 1, "erase retried on flush");
+    check(m_store.stats.blocks == 2, "pending and buffered blocks programmed");
+    read_all();
+    check(m_read_lines == lines, "no line of the pending block lost");
+
+    /* A clear which cannot be started is retried the same way. */
+    m_queue_full = true;
+    m_rejected   = 0;
+    log_store_clear(&m_store);
+    check(m_rejected == 1, "one clear attempt");
+    m_queue_full = false;
+    log_store_flush(&m_store);
+    check(!log_store_is_busy(&m_store), "clear finished on flush");
+    read_all();
+    check(m_read_lines == 0, "empty after the retried clear");
+}
+
+int main(void)
+{
+    printf("------------- Testing compressed log store ---------------\r\n");
+    test_empty();
+    test_wrap();
+    test_reinit();
+    test_async();
+    test_queue_full();
+    printf("%s\r\n", m_fails ? "FAILED" : "PASSED");
+    return m_fails ? 1 : 0;
+}
@@ -0,0 +1,392 @@
+#include "log_store.h"
+
+#include <string.h>
+
+#define ERASED_LEN      0xFFFF
+#define WORD_ALIGN(x)   (((x) + 3u) & ~3u)
+
+enum
+{
+    OP_NONE,
+    OP_CLEAR,
+    OP_ERASE,
+    OP_HEADER,
+    OP_RECORD,
+};
+
+static uint16_t crc16(uint8_t const * p_data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)p_data[i] << 8;
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t page_addr(log_store_t const * p_store, uint32_t idx)
+{
+    return p_store->start_addr + (idx * p_store->page_size);
+}
+
+static bool page_hdr_read(log_store_t const * p_store, uint32_t idx, uint32_t * p_seq)
+{
+    uint32_t hdr[2];
+
+    if (!p_store->p_api->read(p_store->p_context, page_addr(p_store, idx), hdr, sizeof(hdr)) ||
+        (hdr[0] != LOG_STORE_PAGE_MAGIC))
+    {
+        return false;
+    }
+    *p_seq = hdr[1];
+    return true;
+}
+
+/* Reads the header of the record at the given offset. Returns its size in flash, 0 at the end
+   of the written area. */
+static uint32_t record_hdr_read(log_store_t const * p_store,
+                                uint32_t            idx,
+                                uint32_t            offset,
+                                uint16_t *          p_len,
+                                uint16_t *          p_crc)
+{
+    uint8_t hdr[LOG_STORE_REC_HDR_SIZE];
+
+    if (((offset + sizeof(hdr)) > p_store->page_size) ||
+        !p_store->p_api->read(p_store->p_context, page_addr(p_store, idx) + offset,
+                              hdr, sizeof(hdr)))
+    {
+        return 0;
+    }
+
+    *p_len = (uint16_t)(hdr[0] | (hdr[1] << 8));
+    *p_crc = (uint16_t)(hdr[2] | (hdr[3] << 8));
+
+    uint32_t size = WORD_ALIGN(LOG_STORE_REC_HDR_SIZE + *p_len);
+
+    if ((*p_len == ERASED_LEN) || ((offset + size) > p_store->page_size))
+    {
+        return 0;
+    }
+    return size;
+}
+
+static void clear_step(log_store_t * p_store)
+{
+    p_store->clear_idx++;
+    if (p_store->clear_idx == p_store->page_cnt)
+    {
+        p_store->page_idx    = 0;
+        p_store->page_offset = 0;
+        p_store->seq++;
+    }
+}
+
+/* Starts the next flash operation, if any. Completion may be reported before the API function
+   returns, so nothing is touched after a successful start. An operation that cannot be started
+   (e.g. the fstorage queue shared with FDS is full) is retried on the next flash event or flush:
+   moving on to the next page here would erase the whole ring in one call. */
+static void op_next(log_store_t * p_store)
+{
+    log_store_flash_api_t const * p_api = p_store->p_api;
+
+    while (p_store->op == OP_NONE)
+    {
+        if (p_store->clear_idx < p_store->page_cnt)
+        {
+            p_store->op = OP_CLEAR;
+            if (p_api->erase(p_store->p_context, page_addr(p_store, p_store->clear_idx)))
+            {
+                return;
+            }
+        }
+        else if (p_store->out_len == 0)
+        {
+            return;
+        }
+        else if (p_store->page_offset == 0)
+        {
+            p_store->op = OP_ERASE;
+            if (p_api->erase(p_store->p_context, page_addr(p_store, p_store->page_idx)))
+            {
+                return;
+            }
+        }
+        else if ((p_store->page_offset + p_store->out_len) > p_store->page_size)
+        {
+            p_store->page_idx    = (p_store->page_idx + 1) % p_store->page_cnt;
+            p_store->page_offset = 0;
+            p_store->seq++;
+            continue;
+        }
+        else
+        {
+            p_store->op = OP_RECORD;
+            if (p_api->write(p_store->p_context,
+                             page_addr(p_store, p_store->page_idx) + p_store->page_offset,
+                             p_store->p_out,
+                             p_store->out_len))
+            {
+                return;
+            }
+        }
+
+        p_store->op = OP_NONE;
+        p_store->stats.errors++;
+        return;
+    }
+}
+
+void log_store_flash_evt(log_store_t * p_store, bool success)
+{
+    uint8_t op = p_store->op;
+
+    p_store->op = OP_NONE;
+    if (!success)
+    {
+        p_store->stats.errors++;
+    }
+
+    switch (op)
+    {
+        case OP_CLEAR:
+            clear_step(p_store);
+            break;
+
+        case OP_ERASE:
+            if (!success)
+            {
+                p_store->page_offset = p_store->page_size;
+                break;
+            }
+            p_store->stats.erases++;
+            p_store->page_hdr[0] = LOG_STORE_PAGE_MAGIC;
+            p_store->page_hdr[1] = p_store->seq;
+            p_store->op          = OP_HEADER;
+            if (p_store->p_api->write(p_store->p_context,
+                                      page_addr(p_store, p_store->page_idx),
+                                      p_store->page_hdr,
+                                      sizeof(p_store->page_hdr)))
+            {
+                return;
+            }
+            /* The page is erased again when the header write can be started. */
+            p_store->op = OP_NONE;
+            p_store->stats.errors++;
+            return;
+
+        case OP_HEADER:
+            p_store->page_offset = success ? LOG_STORE_PAGE_HDR_SIZE : p_store->page_size;
+            if (success)
+            {
+                p_store->stats.stored_bytes += LOG_STORE_PAGE_HDR_SIZE;
+            }
+            break;
+
+        case OP_RECORD:
+            if (success)
+            {
+                p_store->page_offset        += p_store->out_len;
+                p_store->stats.stored_bytes += p_store->out_len;
+                p_store->stats.blocks++;
+            }
+            else
+            {
+                /* The record may be partially programmed, continue on the next page. */
+                p_store->page_offset = p_store->page_size;
+            }
+            p_store->out_len = 0;
+            break;
+
+        default:
+            break;
+    }
+
+    op_next(p_store);
+}
+
+void log_store_init(log_store_t *                 p_store,
+                    log_store_flash_api_t const * p_api,
+                    void *                        p_context,
+                    uint32_t                      start_addr,
+                    uint32_t                      page_size,
+                    uint32_t                      page_cnt)
+{
+    bool     found    = false;
+    uint32_t best_seq = 0;
+    uint32_t best_idx = 0;
+
+    p_store->p_api       = p_api;
+    p_store->p_context   = p_context;
+    p_store->start_addr  = start_addr;
+    p_store->page_size   = page_size;
+    p_store->page_cnt    = page_cnt;
+    p_store->clear_idx   = page_cnt;
+    p_store->op          = OP_NONE;
+    p_store->block_len   = 0;
+    p_store->out_len     = 0;
+    memset(&p_store->stats, 0, sizeof(p_store->stats));
+
+    for (uint32_t i = 0; i < page_cnt; i++)
+    {
+        uint32_t seq;
+
+        if (page_hdr_read(p_store, i, &seq) && (!found || ((int32_t)(seq - best_seq) > 0)))
+        {
+            found    = true;
+            best_seq = seq;
+            best_idx = i;
+        }
+    }
+
+    if (!found)
+    {
+        p_store->page_idx    = 0;
+        p_store->page_offset = 0;
+        p_store->seq         = 1;
+        return;
+    }
+
+    uint32_t offset = LOG_STORE_PAGE_HDR_SIZE;
+    uint32_t size;
+    uint16_t len = ERASED_LEN;
+    uint16_t crc;
+
+    while ((size = record_hdr_read(p_store, best_idx, offset, &len, &crc)) != 0)
+    {
+        offset += size;
+    }
+    if (len != ERASED_LEN)
+    {
+        /* Garbage after the last record, do not program over it. */
+        offset = page_size;
+    }
+
+    p_store->page_idx    = best_idx;
+    p_store->page_offset = offset;
+    p_store->seq         = best_seq;
+}
+
+void log_store_flush(log_store_t * p_store)
+{
+    /* Retry an operation that could not be started, it may free the output buffer. */
+    op_next(p_store);
+    if ((p_store->block_len == 0) || (p_store->out_len != 0))
+    {
+        return;
+    }
+
+    uint8_t * p_rec = p_store->p_out;
+    size_t    len   = lzss_compress(p_store->p_block,
+                                    p_store->block_len,
+                                    &p_rec[LOG_STORE_REC_HDR_SIZE],
+                                    p_store->out_size - LOG_STORE_REC_HDR_SIZE);
+    if (len == 0)
+    {
+        p_store->stats.dropped++;
+        p_store->block_len = 0;
+        return;
+    }
+
+    uint16_t  crc   = crc16(&p_rec[LOG_STORE_REC_HDR_SIZE], len);
+    size_t    size  = WORD_ALIGN(LOG_STORE_REC_HDR_SIZE + len);
+
+    p_rec[0] = (uint8_t)len;
+    p_rec[1] = (uint8_t)(len >> 8);
+    p_rec[2] = (uint8_t)crc;
+    p_rec[3] = (uint8_t)(crc >> 8);
+    memset(&p_rec[LOG_STORE_REC_HDR_SIZE + len], 0xFF, size - (LOG_STORE_REC_HDR_SIZE + len));
+
+    p_store->stats.raw_bytes += p_store->block_len;
+    p_store->block_len        = 0;
+    p_store->out_len          = (uint16_t)size;
+
+    op_next(p_store);
+}
+
+bool log_store_append(log_store_t * p_store, void const * p_data, size_t len)
+{
+    if ((p_store->block_len + len) > p_store->block_size)
+    {
+        log_store_flush(p_store);
+    }
+
+    if ((p_store->block_len + len) > p_store->block_size)
+    {
+        p_store->stats.dropped++;
+        return false;
+    }
+
+    memcpy(&p_store->p_block[p_store->block_len], p_data, len);
+    p_store->block_len += (uint16_t)len;
+    return true;
+}
+
+void log_store_clear(log_store_t * p_store)
+{
+    p_store->block_len = 0;
+    p_store->clear_idx = 0;
+    op_next(p_store);
+}
+
+bool log_store_is_busy(log_store_t const * p_store)
+{
+    return (p_store->op != OP_NONE) ||
+           (p_store->out_len != 0)  ||
+           (p_store->clear_idx < p_store->page_cnt);
+}
+
+bool log_store_read(log_store_t * p_store, log_store_read_handler_t handler, void * p_context)
+{
+    if (log_store_is_busy(p_store) || !log_store_block_is_empty(p_store))
+    {
+        return false;
+    }
+
+    /* Oldest page first: the one after the page being written. */
+    for (uint32_t i = 1; i <= p_store->page_cnt; i++)
+    {
+        uint32_t idx = (p_store->page_idx + i) % p_store->page_cnt;
+        uint32_t seq;
+
+        if (!page_hdr_read(p_store, idx, &seq) ||
+            ((int32_t)(p_store->seq - seq) < 0) ||
+            ((p_store->seq - seq) >= p_store->page_cnt))
+        {
+            continue;
+        }
+
+        uint32_t offset = LOG_STORE_PAGE_HDR_SIZE;
+        uint32_t size;
+        uint16_t len;
+        uint16_t crc;
+
+        while ((size = record_hdr_read(p_store, idx, offset, &len, &crc)) != 0)
+        {
+            size_t raw_len = 0;
+
+            if ((len <= p_store->out_size) &&
+                p_store->p_api->read(p_store->p_context,
+                                     page_addr(p_store, idx) + offset + LOG_STORE_REC_HDR_SIZE,
+                                     p_store->p_out,
+                                     len) &&
+                (crc16(p_store->p_out, len) == crc))
+            {
+                raw_len = lzss_decompress(p_store->p_out, len,
+                                          p_store->p_block, p_store->block_size);
+            }
+            if (raw_len != 0)
+            {
+                handler(p_context, p_store->p_block, raw_len);
+            }
+            offset += size;
+        }
+    }
+
+    return true;
+}
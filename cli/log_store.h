@@ -0,0 +1,189 @@
+/** @file
+ * @defgroup log_store Compressed log store
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Batches log records in RAM, compresses them and appends them to a ring of flash pages.
+ *
+ * Records are appended to a RAM block. A full (or flushed) block is compressed with @ref lzss
+ * and programmed as one flash record. Flash records are packed into pages. When a page is full
+ * the next page of the range is erased and the oldest history is dropped:
+ *
+ * - page: header (magic, sequence number), then flash records until the erased area.
+ * - flash record: 16-bit compressed length, CRC-16 of the compressed data, the data, padding
+ *   to a word boundary.
+ *
+ * The page with the highest sequence number is the one being written, found again on
+ * initialization. Flash is accessed through @ref log_store_flash_api_t. Operations may complete
+ * asynchronously, the completion is reported with @ref log_store_flash_evt, and only one
+ * operation is in progress at a time.
+ *
+ * The engine has no SDK dependencies and is built on the host by log_store-test.c.
+ */
+#ifndef LOG_STORE_H__
+#define LOG_STORE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "lzss.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOG_STORE_PAGE_MAGIC    0x315A474CUL    //!< "LGZ1".
+#define LOG_STORE_PAGE_HDR_SIZE 8               //!< Magic and sequence number.
+#define LOG_STORE_REC_HDR_SIZE  4               //!< Length and CRC.
+
+/**@brief Flash access functions.
+ *
+ * Each function returns true if the operation was started. Write and erase complete with
+ * a call to @ref log_store_flash_evt, possibly before returning. Read is synchronous.
+ */
+typedef struct
+{
+    bool (*read)(void * p_context, uint32_t addr, void * p_dst, uint32_t len);
+    bool (*write)(void * p_context, uint32_t addr, void const * p_src, uint32_t len);
+    bool (*erase)(void * p_context, uint32_t page_addr);
+} log_store_flash_api_t;
+
+/**@brief Store statistics. */
+typedef struct
+{
+    uint32_t raw_bytes;     //!< Record bytes compressed so far.
+    uint32_t stored_bytes;  //!< Bytes programmed, headers included.
+    uint32_t blocks;        //!< Blocks programmed.
+    uint32_t erases;        //!< Pages erased.
+    uint32_t dropped;       //!< Records dropped because the RAM block was not free.
+    uint32_t errors;        //!< Failed flash operations.
+} log_store_stats_t;
+
+/**@brief Store instance. Use @ref LOG_STORE_DEF to create one. */
+typedef struct
+{
+    log_store_flash_api_t const * p_api;
+    void *                        p_context;
+    uint32_t                      start_addr;
+    uint32_t                      page_size;
+    uint32_t                      page_cnt;
+
+    uint8_t *                     p_block;      //!< Records waiting for compression.
+    uint16_t                      block_size;
+    uint16_t                      block_len;
+    uint8_t *                     p_out;        //!< Flash record being programmed.
+    uint16_t                      out_size;
+    uint16_t                      out_len;
+
+    uint32_t                      page_idx;     //!< Page being written.
+    uint32_t                      page_offset;  //!< Write offset, 0 if not started.
+    uint32_t                      seq;          //!< Sequence number of the page.
+    uint32_t                      clear_idx;    //!< Next page to erase while clearing.
+    uint32_t                      page_hdr[2];  //!< Page header being programmed.
+    uint8_t                       op;           //!< Operation in progress.
+
+    log_store_stats_t             stats;
+} log_store_t;
+
+/**@brief Flash record size for a block of the given size. */
+#define LOG_STORE_OUT_SIZE(block_size) \
+    ((LOG_STORE_REC_HDR_SIZE + LZSS_BOUND(block_size) + 3) & ~3u)
+
+/**@brief Macro for defining a store instance.
+ *
+ * @param _name       Instance name.
+ * @param _block_size Size of the RAM block, at most @ref LZSS_WINDOW_SIZE. The flash record,
+ *                    @ref LOG_STORE_OUT_SIZE, must fit in a page after the page header.
+ */
+#define LOG_STORE_DEF(_name, _block_size)                                               \
+    static uint8_t _name##_block[_block_size];                                          \
+    static uint32_t _name##_out[LOG_STORE_OUT_SIZE(_block_size) / sizeof(uint32_t)];    \
+    static log_store_t _name =                                                          \
+    {                                                                                   \
+        .p_block    = _name##_block,                                                    \
+        .block_size = (_block_size),                                                    \
+        .p_out      = (uint8_t *)_name##_out,                                           \
+        .out_size   = sizeof(_name##_out),                                              \
+    }
+
+/**@brief Callback receiving decompressed blocks, oldest first.
+ *
+ * @param[in] p_context Context given to @ref log_store_read.
+ * @param[in] p_data    Block data, the appended records back to back.
+ * @param[in] len       Block length.
+ */
+typedef void (*log_store_read_handler_t)(void * p_context, uint8_t const * p_data, size_t len);
+
+/**@brief Function for initializing the store and locating the write position.
+ *
+ * @param[in] p_store    Store instance.
+ * @param[in] p_api      Flash access functions.
+ * @param[in] p_context  Context passed to the flash functions.
+ * @param[in] start_addr Address of the first page.
+ * @param[in] page_size  Page size in bytes.
+ * @param[in] page_cnt   Number of pages, at least 2.
+ */
+void log_store_init(log_store_t *                 p_store,
+                    log_store_flash_api_t const * p_api,
+                    void *                        p_context,
+                    uint32_t                      start_addr,
+                    uint32_t                      page_size,
+                    uint32_t                      page_cnt);
+
+/**@brief Function for appending a record. The block is flushed when the record does not fit.
+ *
+ * @retval true  Record buffered.
+ * @retval false Record dropped, the previous block is still being programmed.
+ */
+bool log_store_append(log_store_t * p_store, void const * p_data, size_t len);
+
+/**@brief Function for compressing and programming the current block, if not empty.
+ *
+ * A flash operation that could not be started before is retried.
+ */
+void log_store_flush(log_store_t * p_store);
+
+/**@brief Function for erasing all pages. */
+void log_store_clear(log_store_t * p_store);
+
+/**@brief Function for reporting the completion of a write or erase.
+ *
+ * @param[in] p_store Store instance.
+ * @param[in] success Operation result.
+ */
+void log_store_flash_evt(log_store_t * p_store, bool success);
+
+/**@brief Function for checking if a flash operation or a compressed block is pending. */
+bool log_store_is_busy(log_store_t const * p_store);
+
+/**@brief Function for checking if the RAM block is empty, i.e. the next record starts a block. */
+static inline bool log_store_block_is_empty(log_store_t const * p_store)
+{
+    return (p_store->block_len == 0);
+}
+
+/**@brief Function for reading the free space in the RAM block. */
+static inline size_t log_store_block_space(log_store_t const * p_store)
+{
+    return (size_t)(p_store->block_size - p_store->block_len);
+}
+
+/**@brief Function for reading all stored blocks, oldest first.
+ *
+ * The RAM buffers are reused for reading, so the RAM block must be empty and the store must not
+ * be busy: call @ref log_store_flush and wait for the write to complete first. Records failing
+ * the CRC check are skipped.
+ *
+ * @retval true  Blocks read.
+ * @retval false Store busy or RAM block not empty.
+ */
+bool log_store_read(log_store_t * p_store, log_store_read_handler_t handler, void * p_context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_STORE_H__
+
+/** @} */
@@ -0,0 +1,417 @@
+#include "sdk_common.h"
+#include "log_throttle.h"
+
+#include "app_util_platform.h"
+#include "nrf_log_ctrl.h"
+#include "nrf_log_internal.h"
+#include "nrf_cli.h"
+
+#if !NRF_LOG_DEFERRED
+#error "log_throttle needs NRF_LOG_DEFERRED, in place logging processes every entry at once"
+#endif
+
+#define BUFFER_WORDS    (NRF_LOG_BUFSIZE / sizeof(uint32_t))
+
+/* Upper bound of the number of entries in the buffer, all of them without arguments. */
+#define FIFO_SIZE       (BUFFER_WORDS / HEADER_SIZE)
+
+/* Frontend functions, renamed by the linker. */
+void __real_nrf_log_frontend_std_0(uint32_t severity_mid, char const * const p_str);
+void __real_nrf_log_frontend_std_1(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0);
+void __real_nrf_log_frontend_std_2(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1);
+void __real_nrf_log_frontend_std_3(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2);
+void __real_nrf_log_frontend_std_4(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2, uint32_t val3);
+void __real_nrf_log_frontend_std_5(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2, uint32_t val3,
+                                   uint32_t val4);
+void __real_nrf_log_frontend_std_6(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2, uint32_t val3,
+                                   uint32_t val4, uint32_t val5);
+void __real_nrf_log_frontend_hexdump(uint32_t severity_mid, const void * const p_data,
+                                     uint16_t length);
+bool __real_nrf_log_frontend_dequeue(void);
+void __real_nrf_log_panic(void);
+
+static log_throttle_stats_t m_stats[LOG_THROTTLE_MAX_MODULES];
+
+/* Sizes, in words, of the entries in the logger buffer, oldest first. */
+static uint16_t m_fifo[FIFO_SIZE];
+static uint16_t m_fifo_head;
+static uint16_t m_fifo_cnt;
+static uint32_t m_used;
+static uint32_t m_used_max;
+
+static bool               m_auto       = LOG_THROTTLE_AUTO;
+static bool               m_throttling;
+static uint32_t           m_throttle_cnt;
+static nrf_log_severity_t m_severity   = (nrf_log_severity_t)LOG_THROTTLE_SEVERITY;
+
+/* Set by nrf_log_panic(): the frontend then drains the buffer itself after every entry, calling
+   nrf_log_frontend_dequeue() from nrf_log_frontend.c, which the linker does not wrap. */
+static bool               m_autoflush;
+
+static void stat_inc(uint16_t * p_cnt)
+{
+    if (*p_cnt < UINT16_MAX)
+    {
+        (*p_cnt)++;
+    }
+}
+
+/* Called with interrupts disabled, so that the queued sizes follow the order of the entries in
+   the logger buffer. */
+static bool entry_admit(uint32_t severity_mid, uint32_t args_words)
+{
+    uint32_t               module_id = severity_mid >> NRF_LOG_MODULE_ID_POS;
+    uint32_t               level     = severity_mid & NRF_LOG_LEVEL_MASK;
+    uint32_t               words     = HEADER_SIZE + args_words;
+    log_throttle_stats_t * p_stats   = &m_stats[MIN(module_id, LOG_THROTTLE_MAX_MODULES - 1)];
+
+    if (level == NRF_LOG_SEVERITY_INFO_RAW)
+    {
+        level = NRF_LOG_SEVERITY_INFO;
+    }
+
+    if (m_throttling && (level > m_severity))
+    {
+        stat_inc(&p_stats->throttled);
+        return false;
+    }
+
+    if (m_autoflush)
+    {
+        /* Processed before the frontend returns, with the entries still queued. */
+        m_fifo_cnt = 0;
+        m_used     = 0;
+        return true;
+    }
+
+    if (((m_used + words) > BUFFER_WORDS) || (m_fifo_cnt == FIFO_SIZE))
+    {
+        stat_inc(&p_stats->dropped);
+        return false;
+    }
+
+    m_fifo[(m_fifo_head + m_fifo_cnt) % FIFO_SIZE] = (uint16_t)words;
+    m_fifo_cnt++;
+    m_used += words;
+    m_used_max = MAX(m_used_max, m_used);
+
+    if (m_auto && !m_throttling &&
+        ((m_used * 100) >= (BUFFER_WORDS * LOG_THROTTLE_HIGH_WATERMARK)))
+    {
+        m_throttling = true;
+        m_throttle_cnt++;
+    }
+
+    return true;
+}
+
+static void entry_release(bool pending)
+{
+    CRITICAL_REGION_ENTER();
+
+    if (!pending)
+    {
+        /* Buffer is empty, drop whatever the estimate still holds (e.g. entries overwritten by
+           the logger or pushed strings). */
+        m_fifo_cnt = 0;
+        m_used     = 0;
+    }
+    else if (m_fifo_cnt != 0)
+    {
+        m_used -= m_fifo[m_fifo_head];
+        m_fifo_head = (m_fifo_head + 1) % FIFO_SIZE;
+        m_fifo_cnt--;
+    }
+
+    if (m_throttling && ((m_used * 100) <= (BUFFER_WORDS * LOG_THROTTLE_LOW_WATERMARK)))
+    {
+        m_throttling = false;
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_0(uint32_t severity_mid, char const * const p_str)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 0))
+    {
+        __real_nrf_log_frontend_std_0(severity_mid, p_str);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_1(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 1))
+    {
+        __real_nrf_log_frontend_std_1(severity_mid, p_str, val0);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_2(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 2))
+    {
+        __real_nrf_log_frontend_std_2(severity_mid, p_str, val0, val1);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_3(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 3))
+    {
+        __real_nrf_log_frontend_std_3(severity_mid, p_str, val0, val1, val2);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_4(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2, uint32_t val3)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 4))
+    {
+        __real_nrf_log_frontend_std_4(severity_mid, p_str, val0, val1, val2, val3);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_5(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2, uint32_t val3,
+                                   uint32_t val4)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 5))
+    {
+        __real_nrf_log_frontend_std_5(severity_mid, p_str, val0, val1, val2, val3, val4);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_std_6(uint32_t severity_mid, char const * const p_str,
+                                   uint32_t val0, uint32_t val1, uint32_t val2, uint32_t val3,
+                                   uint32_t val4, uint32_t val5)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, 6))
+    {
+        __real_nrf_log_frontend_std_6(severity_mid, p_str, val0, val1, val2, val3, val4, val5);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void __wrap_nrf_log_frontend_hexdump(uint32_t severity_mid, const void * const p_data,
+                                     uint16_t length)
+{
+    CRITICAL_REGION_ENTER();
+    if (entry_admit(severity_mid, CEIL_DIV(length, sizeof(uint32_t))))
+    {
+        __real_nrf_log_frontend_hexdump(severity_mid, p_data, length);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+bool __wrap_nrf_log_frontend_dequeue(void)
+{
+    bool pending = __real_nrf_log_frontend_dequeue();
+
+    entry_release(pending);
+
+    return pending;
+}
+
+void __wrap_nrf_log_panic(void)
+{
+    CRITICAL_REGION_ENTER();
+    m_autoflush  = true;
+    m_throttling = false;
+    CRITICAL_REGION_EXIT();
+
+    __real_nrf_log_panic();
+}
+
+void log_throttle_auto_set(bool enable)
+{
+    CRITICAL_REGION_ENTER();
+    m_auto = enable;
+    if (!enable)
+    {
+        m_throttling = false;
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void log_throttle_severity_set(nrf_log_severity_t severity)
+{
+    m_severity = severity;
+}
+
+log_throttle_stats_t const * log_throttle_stats_get(uint32_t module_id)
+{
+    return &m_stats[MIN(module_id, LOG_THROTTLE_MAX_MODULES - 1)];
+}
+
+uint32_t log_throttle_occupancy_get(void)
+{
+    return (m_used * 100) / BUFFER_WORDS;
+}
+
+static char const * const m_severity_names[] =
+{
+    [NRF_LOG_SEVERITY_NONE]    = "none",
+    [NRF_LOG_SEVERITY_ERROR]   = "error",
+    [NRF_LOG_SEVERITY_WARNING] = "warning",
+    [NRF_LOG_SEVERITY_INFO]    = "info",
+    [NRF_LOG_SEVERITY_DEBUG]   = "debug",
+};
+
+static void cmd_log_throttle_show(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    nrf_cli_print(p_cli, "buffer: %u%% used, peak %u%%, throttling %s (%s, entered %u times)",
+                  log_throttle_occupancy_get(),
+                  (m_used_max * 100) / BUFFER_WORDS,
+                  m_throttling ? "active" : "inactive",
+                  m_auto ? "auto" : "off",
+                  m_throttle_cnt);
+    nrf_cli_print(p_cli, "accepted while throttling: %s and more severe",
+                  m_severity_names[m_severity]);
+
+    nrf_cli_print(p_cli, "%-24s %8s %9s", "module", "dropped", "throttled");
+    for (uint32_t i = 0; i < MIN(nrf_log_module_cnt_get(), LOG_THROTTLE_MAX_MODULES); i++)
+    {
+        if ((m_stats[i].dropped != 0) || (m_stats[i].throttled != 0))
+        {
+            nrf_cli_print(p_cli, "%-24s %8u %9u",
+                          (i < (LOG_THROTTLE_MAX_MODULES - 1)) ?
+                          nrf_log_module_name_get(i, false) : "(others)",
+                          m_stats[i].dropped,
+                          m_stats[i].throttled);
+        }
+    }
+}
+
+static void cmd_log_throttle_reset(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    CRITICAL_REGION_ENTER();
+    memset(m_stats, 0, sizeof(m_stats));
+    m_used_max     = m_used;
+    m_throttle_cnt = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+static void cmd_log_throttle_auto(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 2)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    if (!strcmp(argv[1], "on"))
+    {
+        log_throttle_auto_set(true);
+    }
+    else if (!strcmp(argv[1], "off"))
+    {
+        log_throttle_auto_set(false);
+    }
+    else
+    {
+        nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+    }
+}
+
+static void cmd_log_throttle_severity(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 2)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    for (size_t i = NRF_LOG_SEVERITY_ERROR; i < ARRAY_SIZE(m_severity_names); i++)
+    {
+        if (!strcmp(argv[1], m_severity_names[i]))
+        {
+            log_throttle_severity_set((nrf_log_severity_t)i);
+            return;
+        }
+    }
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+static void cmd_log_throttle(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_log_throttle)
+{
+    NRF_CLI_CMD(auto,     NULL, "Throttle above the buffer watermark: auto <on|off>.",
+                cmd_log_throttle_auto),
+    NRF_CLI_CMD(reset,    NULL, "Reset counters.", cmd_log_throttle_reset),
+    NRF_CLI_CMD(severity, NULL, "Least severe level accepted while throttling: "
+                "severity <error|warning|info|debug>.", cmd_log_throttle_severity),
+    NRF_CLI_CMD(show,     NULL, "Show buffer usage and per module counters.",
+                cmd_log_throttle_show),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(log_throttle, &m_sub_log_throttle, "Logger overflow accounting",
+                     cmd_log_throttle);
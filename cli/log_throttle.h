@@ -0,0 +1,74 @@
+/** @file
+ * @defgroup log_throttle Logger overflow accounting and throttling
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Admission control in front of the deferred logger.
+ *
+ * With NRF_LOG_ALLOW_OVERFLOW the logger silently overwrites the oldest entries when the buffer
+ * is full, and only the total number of lost entries is ever reported. This module sits between
+ * the NRF_LOG macros and the logger frontend: the frontend functions are wrapped at link time
+ * (`-Wl,--wrap`, see the Makefile), so no call site changes.
+ *
+ * The wrappers keep an estimate of the buffer occupancy: the size of every accepted entry is
+ * queued when it is stored and released when the logger processes it. An entry that would not fit
+ * is discarded before it reaches the frontend and counted for its module. When the occupancy
+ * crosses @ref LOG_THROTTLE_HIGH_WATERMARK percent, entries less severe than
+ * @ref LOG_THROTTLE_SEVERITY are rejected up front until the occupancy falls under
+ * @ref LOG_THROTTLE_LOW_WATERMARK percent, so bursts do not fill the buffer with messages that
+ * would be dropped anyway. Rejected entries are counted separately.
+ *
+ * Strings copied with NRF_LOG_PUSH are not accounted for, the gap between the high watermark
+ * and 100% absorbs them.
+ *
+ * The wrapping only redirects the calls from outside of nrf_log_frontend.c. Inside it, the
+ * frontend dequeues on its own after nrf_log_panic(), so the panic is wrapped as well: from then
+ * on every entry is admitted and the estimate is cleared. Overwritten entries are caught up with
+ * when the buffer runs empty. LTO resolves the calls before the wrapping, the Makefile leaves the
+ * module out of the LTO profiles (LOG_THROTTLE=0).
+ *
+ * The `log_throttle` CLI command prints the counters and controls the throttling.
+ */
+#ifndef LOG_THROTTLE_H__
+#define LOG_THROTTLE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_log_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Module counters. */
+typedef struct
+{
+    uint16_t dropped;    //!< Entries discarded because the buffer was full.
+    uint16_t throttled;  //!< Entries rejected while throttling was active.
+} log_throttle_stats_t;
+
+/**@brief Function for enabling or disabling automatic throttling. */
+void log_throttle_auto_set(bool enable);
+
+/**@brief Function for setting the least severe level accepted while throttling. */
+void log_throttle_severity_set(nrf_log_severity_t severity);
+
+/**@brief Function for reading the counters of a module.
+ *
+ * @param[in] module_id Logger module ID.
+ *
+ * @return Counters, modules above @ref LOG_THROTTLE_MAX_MODULES share the last entry.
+ */
+log_throttle_stats_t const * log_throttle_stats_get(uint32_t module_id);
+
+/**@brief Function for reading the estimated buffer occupancy in percent. */
+uint32_t log_throttle_occupancy_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_THROTTLE_H__
+
+/** @} */
@@ -0,0 +1,145 @@
+#include "lzss.h"
+
+#include <string.h>
+
+#define HASH_SIZE   (1u << LZSS_HASH_BITS)
+#define NO_POS      0xFFFF
+
+/* Last position of every hashed 3 byte sequence, NO_POS if none. */
+static uint16_t m_head[HASH_SIZE];
+
+static inline uint32_t hash3(uint8_t const * p)
+{
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+
+    return (v * 2654435761u) >> (32 - LZSS_HASH_BITS);
+}
+
+size_t lzss_compress(uint8_t const * p_src, size_t len, uint8_t * p_dst, size_t dst_size)
+{
+    size_t   in   = 0;
+    size_t   out  = 0;
+    size_t   flag = 0;
+    uint32_t bit  = 8;
+
+    if (len > LZSS_WINDOW_SIZE)
+    {
+        return 0;
+    }
+
+    memset(m_head, 0xFF, sizeof(m_head));
+
+    while (in < len)
+    {
+        if (bit == 8)
+        {
+            if (out >= dst_size)
+            {
+                return 0;
+            }
+            flag         = out++;
+            p_dst[flag]  = 0;
+            bit          = 0;
+        }
+
+        size_t match_len  = 0;
+        size_t match_dist = 0;
+
+        if ((len - in) >= LZSS_MATCH_MIN)
+        {
+            uint32_t h    = hash3(&p_src[in]);
+            uint16_t cand = m_head[h];
+
+            m_head[h] = (uint16_t)in;
+            if (cand != NO_POS)
+            {
+                size_t max = len - in;
+
+                if (max > LZSS_MATCH_MAX)
+                {
+                    max = LZSS_MATCH_MAX;
+                }
+                while ((match_len < max) && (p_src[cand + match_len] == p_src[in + match_len]))
+                {
+                    match_len++;
+                }
+                match_dist = in - cand;
+            }
+        }
+
+        if (match_len >= LZSS_MATCH_MIN)
+        {
+            if ((out + 2) > dst_size)
+            {
+                return 0;
+            }
+            p_dst[out++] = (uint8_t)(((match_dist - 1) >> 4) & 0xFF);
+            p_dst[out++] = (uint8_t)((((match_dist - 1) & 0x0F) << 4) |
+                                     (match_len - LZSS_MATCH_MIN));
+
+            /* Index the positions inside the match, so that repeated text is found again. */
+            for (size_t i = 1; (i < match_len) && ((in + i + LZSS_MATCH_MIN) <= len); i++)
+            {
+                m_head[hash3(&p_src[in + i])] = (uint16_t)(in + i);
+            }
+            in += match_len;
+        }
+        else
+        {
+            if (out >= dst_size)
+            {
+                return 0;
+            }
+            p_dst[flag] |= (uint8_t)(1u << bit);
+            p_dst[out++] = p_src[in++];
+        }
+        bit++;
+    }
+
+    return out;
+}
+
+size_t lzss_decompress(uint8_t const * p_src, size_t len, uint8_t * p_dst, size_t dst_size)
+{
+    size_t in  = 0;
+    size_t out = 0;
+
+    while (in < len)
+    {
+        uint8_t flags = p_src[in++];
+
+        for (uint32_t bit = 0; (bit < 8) && (in < len); bit++)
+        {
+            if (flags & (1u << bit))
+            {
+                if (out >= dst_size)
+                {
+                    return 0;
+                }
+                p_dst[out++] = p_src[in++];
+                continue;
+            }
+
+            if ((in + 2) > len)
+            {
+                return 0;
+            }
+
+            size_t dist  = (((size_t)p_src[in] << 4) | (p_src[in + 1] >> 4)) + 1;
+            size_t count = (p_src[in + 1] & 0x0F) + LZSS_MATCH_MIN;
+
+            in += 2;
+            if ((dist > out) || ((out + count) > dst_size))
+            {
+                return 0;
+            }
+            /* Byte by byte, the source may overlap the destination. */
+            for (size_t i = 0; i < count; i++, out++)
+            {
+                p_dst[out] = p_dst[out - dist];
+            }
+        }
+    }
+
+    return out;
+}
@@ -0,0 +1,66 @@
+/** @file
+ * @defgroup lzss LZSS block compression
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Small LZSS codec for blocks of up to 4 KB, independent of the SDK.
+ *
+ * The output is a sequence of groups: a flag byte followed by up to eight items, least
+ * significant flag bit first. A set bit is a literal byte. A cleared bit is a two byte match
+ * holding the distance minus one (12 bits) and the length minus @ref LZSS_MATCH_MIN (4 bits).
+ *
+ * The compressor finds matches through a hash table of the last position of every 3 byte
+ * sequence, without chains. It trades some ratio for speed and a fixed
+ * 2^@ref LZSS_HASH_BITS * 2 bytes of RAM. The table is static, so the compressor is not
+ * reentrant.
+ */
+#ifndef LZSS_H__
+#define LZSS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LZSS_WINDOW_SIZE    4096    //!< Largest match distance and largest block.
+#define LZSS_MATCH_MIN      3       //!< Shortest match.
+#define LZSS_MATCH_MAX      18      //!< Longest match.
+
+#ifndef LZSS_HASH_BITS
+#define LZSS_HASH_BITS      10      //!< Size of the match finder table.
+#endif
+
+/**@brief Worst case size of the compressed data. */
+#define LZSS_BOUND(len)     ((len) + ((len) + 7) / 8)
+
+/**@brief Function for compressing a block.
+ *
+ * @param[in]  p_src    Data to compress.
+ * @param[in]  len      Data length, at most @ref LZSS_WINDOW_SIZE.
+ * @param[out] p_dst    Output buffer.
+ * @param[in]  dst_size Output buffer size.
+ *
+ * @return Compressed length, 0 if the output buffer is too small.
+ */
+size_t lzss_compress(uint8_t const * p_src, size_t len, uint8_t * p_dst, size_t dst_size);
+
+/**@brief Function for decompressing a block.
+ *
+ * @param[in]  p_src    Compressed data.
+ * @param[in]  len      Compressed length.
+ * @param[out] p_dst    Output buffer.
+ * @param[in]  dst_size Output buffer size.
+ *
+ * @return Decompressed length, 0 if the data is corrupted or does not fit.
+ */
+size_t lzss_decompress(uint8_t const * p_src, size_t len, uint8_t * p_dst, size_t dst_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LZSS_H__
+
+/** @} */
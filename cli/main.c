@@ -60,11 +60,20 @@
 #include "nrf_log.h"
 #include "nrf_log_ctrl.h"
 #include "nrf_log_default_backends.h"
-#include "nrf_log_backend_flash.h"
-#include "nrf_fstorage_nvmc.h"
+#include "log_backend_bin.h"
+#include "log_backend_store.h"
+#include "crash_log.h"
 
 #include "nrf_mpu_lib.h"
 #include "nrf_stack_guard.h"
+#include "nrf_pwr_mgmt.h"
+
+#include "bench_dwt.h"
+#include "coop_sched.h"
+#include "cli_batch_transport.h"
+#include "telemetry.h"
+#include "timestamp.h"
+#include "stack_usage.h"
 
 //#if defined(APP_USBD_ENABLED) && APP_USBD_ENABLED
 #define CLI_OVER_USB_CDC_ACM 1
@@ -76,8 +85,6 @@
 #include "app_usbd_string_desc.h"
 #include "app_usbd_cdc_acm.h"
 
-/* If enabled then CYCCNT (high resolution) timestamp is used for the logger. */
-#define USE_CYCCNT_TIMESTAMP_FOR_LOG 0
 
 /**@file
  * @defgroup CLI_example main.c
@@ -86,20 +93,12 @@
  *
  */
 
-#if NRF_LOG_BACKEND_FLASHLOG_ENABLED
-NRF_LOG_BACKEND_FLASHLOG_DEF(m_flash_log_backend);
-#endif
-
-#if NRF_LOG_BACKEND_CRASHLOG_ENABLED
-NRF_LOG_BACKEND_CRASHLOG_DEF(m_crash_log_backend);
-#endif
-
-/* Counter timer. */
-APP_TIMER_DEF(m_timer_0);
+/* Cycle counts measured at boot, read from the target by apps/build/profile_bench.py */
+volatile uint32_t bench_boot_cycles __attribute__((used));
+volatile uint32_t bench_cli_init_cycles __attribute__((used));
 
-/* Declared in demo_cli.c */
-extern uint32_t m_counter;
-extern bool m_counter_active;
+/* Defined in demo_cli_cmds.c, starts the counter command timer. */
+ret_code_t demo_cli_counter_init(void);
 
 #if CLI_OVER_USB_CDC_ACM
 
@@ -146,9 +145,13 @@ static void usbd_user_ev_handler(app_usbd_event_type_t event)
 
 //#if CLI_OVER_USB_CDC_ACM
 NRF_CLI_CDC_ACM_DEF(m_cli_cdc_acm_transport);
+/* Adds 'batch begin'/'batch end' support to the USB console. */
+CLI_BATCH_TRANSPORT_DEF(m_cli_cdc_acm_batch,
+                        &m_cli_cdc_acm_transport.transport,
+                        CLI_BATCH_BUFFER_SIZE);
 NRF_CLI_DEF(m_cli_cdc_acm,
             "usb_cli:~$ ",
-            &m_cli_cdc_acm_transport.transport,
+            &m_cli_cdc_acm_batch.transport,
             '\r',
             CLI_EXAMPLE_LOG_QUEUE_SIZE);
 
@@ -159,17 +162,6 @@ NRF_CLI_DEF(m_cli_rtt,
             '\n',
             CLI_EXAMPLE_LOG_QUEUE_SIZE);
 
-static void timer_handle(void * p_context)
-{
-    UNUSED_PARAMETER(p_context);
-
-    if (m_counter_active)
-    {
-        m_counter++;
-        NRF_LOG_RAW_INFO("counter = %d\n", m_counter);
-    }
-}
-
 static void cli_start(void)
 {
     ret_code_t ret;
@@ -183,15 +175,19 @@ static void cli_start(void)
     APP_ERROR_CHECK(ret);
 }
 
+/* The binary backend replaces the log backends of the CLI instances: the logger sends every
+   entry to every backend, a formatting one left next to it would cost as much as before. */
+#define CLI_LOG_BACKEND (!LOG_BACKEND_BIN_ENABLED)
+
 static void cli_init(void)
 {
     ret_code_t ret;
 
 //#if CLI_OVER_USB_CDC_ACM
-    ret = nrf_cli_init(&m_cli_cdc_acm, NULL, true, true, NRF_LOG_SEVERITY_INFO);
+    ret = nrf_cli_init(&m_cli_cdc_acm, NULL, true, CLI_LOG_BACKEND, NRF_LOG_SEVERITY_INFO);
     APP_ERROR_CHECK(ret);
 
-    ret = nrf_cli_init(&m_cli_rtt, NULL, true, true, NRF_LOG_SEVERITY_INFO);
+    ret = nrf_cli_init(&m_cli_rtt, NULL, true, CLI_LOG_BACKEND, NRF_LOG_SEVERITY_INFO);
     APP_ERROR_CHECK(ret);
 }
 
@@ -230,34 +226,51 @@ static void usbd_init(void)
 }
 
 
-static void cli_process(void)
+/* Scheduler poll functions. nrf_cli_process() cannot be split and does not report pending work,
+   it is called once per loop iteration and the CLI slot budget only accounts for overruns. The
+   handlers that would overrun it, like bench run, hand their work over to coop_sched_defer(). */
+static bool log_poll(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+    return NRF_LOG_PROCESS();
+}
+
+static bool cli_poll(void * p_context)
+{
+    nrf_cli_process((nrf_cli_t const *)p_context);
+    return false;
+}
+
+static coop_sched_slot_t m_sched_slots[] =
 {
+    COOP_SCHED_SLOT("log", log_poll, NULL,                   COOP_SCHED_LOG_BUDGET_CYCLES),
 //#if CLI_OVER_USB_CDC_ACM
-    nrf_cli_process(&m_cli_cdc_acm);
+    COOP_SCHED_SLOT("usb", cli_poll, (void *)&m_cli_cdc_acm, COOP_SCHED_CLI_BUDGET_CYCLES),
+    COOP_SCHED_SLOT("rtt", cli_poll, (void *)&m_cli_rtt,     COOP_SCHED_CLI_BUDGET_CYCLES),
+};
 
-    nrf_cli_process(&m_cli_rtt);
+static void sched_init(void)
+{
+    ret_code_t ret = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(ret);
+
+    coop_sched_init(m_sched_slots, ARRAY_SIZE(m_sched_slots));
 }
 
 
 static void flashlog_init(void)
 {
     ret_code_t ret;
-    int32_t backend_id;
 
-    ret = nrf_log_backend_flash_init(&nrf_fstorage_nvmc);
+#if LOG_STORE_ENABLED
+    ret = log_backend_store_init(NRF_LOG_SEVERITY_INFO);
     APP_ERROR_CHECK(ret);
-#if NRF_LOG_BACKEND_FLASHLOG_ENABLED
-    backend_id = nrf_log_backend_add(&m_flash_log_backend, NRF_LOG_SEVERITY_WARNING);
-    APP_ERROR_CHECK_BOOL(backend_id >= 0);
-
-    nrf_log_backend_enable(&m_flash_log_backend);
 #endif
 
-#if NRF_LOG_BACKEND_CRASHLOG_ENABLED
-    backend_id = nrf_log_backend_add(&m_crash_log_backend, NRF_LOG_SEVERITY_INFO);
-    APP_ERROR_CHECK_BOOL(backend_id >= 0);
-
-    nrf_log_backend_enable(&m_crash_log_backend);
+#if CRASH_LOG_ENABLED
+    /* Saves the crash captured before the reset, if any. */
+    ret = crash_log_init(NRF_LOG_SEVERITY_INFO);
+    APP_ERROR_CHECK(ret);
 #endif
 }
 
@@ -277,17 +290,16 @@ int main(void)
 {
     ret_code_t ret;
 
-    if (USE_CYCCNT_TIMESTAMP_FOR_LOG)
-    {
-        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
-        DWT->CYCCNT = 0;
-        APP_ERROR_CHECK(NRF_LOG_INIT(cyccnt_get, 64000000));
-    }
-    else
-    {
-        APP_ERROR_CHECK(NRF_LOG_INIT(app_timer_cnt_get));
-    }
+#if STACK_USAGE_ENABLED
+    stack_usage_paint();
+#endif
+
+    /* CYCCNT is always running, it is used to measure the boot time and by the scheduler. */
+    bench_dwt_enable();
+    DWT->CYCCNT = 0;
+
+    /* Raw CYCCNT until timestamp_init(), see timestamp.h */
+    APP_ERROR_CHECK(NRF_LOG_INIT(timestamp_log_get, TIMESTAMP_LOG_FREQ));
 
     ret = nrf_drv_clock_init();
     APP_ERROR_CHECK(ret);
@@ -296,13 +308,19 @@ int main(void)
     ret = app_timer_init();
     APP_ERROR_CHECK(ret);
 
-    ret = app_timer_create(&m_timer_0, APP_TIMER_MODE_REPEATED, timer_handle);
+    ret = timestamp_init();
+    APP_ERROR_CHECK(ret);
+
+    ret = demo_cli_counter_init();
     APP_ERROR_CHECK(ret);
 
-    ret = app_timer_start(m_timer_0, APP_TIMER_TICKS(1000), NULL);
+    ret = telemetry_init();
     APP_ERROR_CHECK(ret);
 
+    /* nrf_cli_init() copies the command names to RAM and sorts them. */
+    bench_cli_init_cycles = cyccnt_get();
     cli_init();
+    bench_cli_init_cycles = cyccnt_get() - bench_cli_init_cycles;
 
     usbd_init();
 
@@ -316,15 +334,25 @@ int main(void)
 
     flashlog_init();
 
+#if LOG_BACKEND_BIN_ENABLED
+    ret = log_backend_bin_init(NRF_LOG_SEVERITY_DEBUG);
+    APP_ERROR_CHECK(ret);
+#endif
+
     stack_guard_init();
 
+    sched_init();
+
+    bench_boot_cycles = cyccnt_get();
+
     NRF_LOG_RAW_INFO("Command Line Interface example started.\n");
+    NRF_LOG_RAW_INFO("Boot: %u cycles, cli_init: %u cycles.\n",
+                     bench_boot_cycles, bench_cli_init_cycles);
     NRF_LOG_RAW_INFO("Please press the Tab key to see all available commands.\n");
 
     while (true)
     {
-        UNUSED_RETURN_VALUE(NRF_LOG_PROCESS());
-        cli_process();
+        coop_sched_run();
     }
 }
 
@@ -0,0 +1,107 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(STACK_USAGE)
+#include "stack_usage.h"
+
+#include "nrf.h"
+#include "app_util_platform.h"
+#include "nrf_cli.h"
+#if NRF_MODULE_ENABLED(NRF_STACK_GUARD)
+#include "nrf_stack_guard.h"
+#endif
+
+/* Main stack boundaries, from the linker script. */
+extern uint32_t __StackLimit;
+extern uint32_t __StackTop;
+
+/* Lowest word that can be accessed, above the MPU region of the stack guard. */
+static uint32_t * stack_bottom(void)
+{
+#if NRF_MODULE_ENABLED(NRF_STACK_GUARD)
+    return (uint32_t *)(STACK_GUARD_BASE + STACK_GUARD_SIZE);
+#else
+    return &__StackLimit;
+#endif
+}
+
+void stack_usage_paint(void)
+{
+    uint32_t * p_word = stack_bottom();
+
+    /* An interrupt would push its frame into the painted area. */
+    CRITICAL_REGION_ENTER();
+    uint32_t * p_sp = (uint32_t *)__get_MSP();
+
+    while (p_word < p_sp)
+    {
+        *p_word++ = STACK_USAGE_PATTERN;
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+size_t stack_usage_main_get(size_t * p_size)
+{
+    uint32_t * p_word = stack_bottom();
+
+    *p_size = (size_t)((uint8_t *)&__StackTop - (uint8_t *)p_word);
+
+    while ((p_word < &__StackTop) && (*p_word == STACK_USAGE_PATTERN))
+    {
+        p_word++;
+    }
+
+    return (size_t)((uint8_t *)&__StackTop - (uint8_t *)p_word);
+}
+
+static void usage_print(nrf_cli_t const * p_cli, char const * p_name, size_t size, size_t used)
+{
+    nrf_cli_print(p_cli, "%-16s %6u %6u %6u %3u%%", p_name, size, used, size - used,
+                  (used * 100) / size);
+}
+
+static void cmd_stack_repaint(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    stack_usage_paint();
+}
+
+static void cmd_stack(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+        return;
+    }
+
+    size_t size;
+    size_t used = stack_usage_main_get(&size);
+
+    nrf_cli_print(p_cli, "%-16s %6s %6s %6s %4s", "stack", "size", "used", "free", "use");
+    usage_print(p_cli, "main", size, used);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_stack)
+{
+    NRF_CLI_CMD(repaint, NULL, "Restart the measurement of the main stack.", cmd_stack_repaint),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(stack, &m_sub_stack, "Print the stack high-water marks in bytes",
+                     cmd_stack);
+
+#endif // NRF_MODULE_ENABLED(STACK_USAGE)
@@ -0,0 +1,53 @@
+/** @file
+ * @defgroup stack_usage Stack usage
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Stack high-water marks, to size __STACK_SIZE from measurements.
+ *
+ * @ref stack_usage_paint fills the unused part of the main stack with @ref STACK_USAGE_PATTERN
+ * early in main(). The high-water mark is the lowest word that no longer holds the pattern, so it
+ * covers main() and every interrupt handler since the painting. The words protected by
+ * nrf_stack_guard are neither painted nor read.
+ *
+ * The `stack` CLI command prints the high-water mark of the main stack. `stack repaint` restarts
+ * the measurement, for example before running a single command. The FreeRTOS task stacks are
+ * measured by the stack_usage module of blinky_freertos.
+ *
+ * The value is a lower bound: a function may reserve stack it never writes, or write the pattern
+ * value itself. Keep a margin when shrinking the stack.
+ */
+#ifndef STACK_USAGE_H__
+#define STACK_USAGE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STACK_USAGE_PATTERN 0xA5A5A5A5UL    //!< Same as the FreeRTOS task stack filling.
+
+/**@brief Function for painting the main stack below the current stack pointer.
+ *
+ * Call at the start of main(), before nrf_stack_guard_init(). Interrupts are disabled while
+ * painting, so it may also be called later.
+ */
+void stack_usage_paint(void);
+
+/**@brief Function for reading the main stack usage.
+ *
+ * @param[out] p_size Usable main stack size in bytes, without the stack guard.
+ *
+ * @return Highest number of bytes used since the last painting.
+ */
+size_t stack_usage_main_get(size_t * p_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STACK_USAGE_H__
+
+/** @} */
@@ -0,0 +1,204 @@
+#include "sdk_common.h"
+#include "telemetry.h"
+
+#include <stdlib.h>
+
+#include "nrf.h"
+#include "app_timer.h"
+#include "nrf_cli.h"
+
+NRF_SECTION_DEF(telemetry_counters, telemetry_counter_t);
+
+#define TELEMETRY_COUNTER_CNT   NRF_SECTION_ITEM_COUNT(telemetry_counters, telemetry_counter_t)
+#define TELEMETRY_COUNTER_GET(i) NRF_SECTION_ITEM_GET(telemetry_counters, telemetry_counter_t, (i))
+
+/* Sample layout: app_timer timestamp followed by the counter values. */
+#define TELEMETRY_SAMPLE_WORDS  (1 + TELEMETRY_MAX_COUNTERS)
+
+STATIC_ASSERT(IS_POWER_OF_TWO(TELEMETRY_BUFFER_SAMPLES));
+
+APP_TIMER_DEF(m_sample_timer);
+
+/* Single producer (timer handler) / single consumer (CLI) ring buffer. The indexes run freely,
+   each side writes only its own one, so no locking is needed. */
+static uint32_t          m_samples[TELEMETRY_BUFFER_SAMPLES][TELEMETRY_SAMPLE_WORDS];
+static volatile uint32_t m_wr_idx;
+static volatile uint32_t m_rd_idx;
+static volatile uint32_t m_dropped;
+static uint32_t          m_interval_ms = TELEMETRY_SAMPLE_INTERVAL_MS;
+
+static size_t counter_cnt(void)
+{
+    return MIN(TELEMETRY_COUNTER_CNT, TELEMETRY_MAX_COUNTERS);
+}
+
+static void sample_timer_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    uint32_t wr = m_wr_idx;
+
+    if ((wr - m_rd_idx) >= TELEMETRY_BUFFER_SAMPLES)
+    {
+        m_dropped++;
+        return;
+    }
+
+    uint32_t * p_sample = m_samples[wr & (TELEMETRY_BUFFER_SAMPLES - 1)];
+
+    p_sample[0] = app_timer_cnt_get();
+    for (size_t i = 0; i < counter_cnt(); i++)
+    {
+        p_sample[1 + i] = telemetry_counter_get(TELEMETRY_COUNTER_GET(i));
+    }
+
+    /* Sample must be complete before it is published. */
+    __DMB();
+    m_wr_idx = wr + 1;
+}
+
+ret_code_t telemetry_init(void)
+{
+    ret_code_t ret;
+
+    ret = app_timer_create(&m_sample_timer, APP_TIMER_MODE_REPEATED, sample_timer_handler);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    return app_timer_start(m_sample_timer, APP_TIMER_TICKS(m_interval_ms), NULL);
+}
+
+static void cmd_telemetry_show(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    for (size_t i = 0; i < TELEMETRY_COUNTER_CNT; i++)
+    {
+        telemetry_counter_t const * p_counter = TELEMETRY_COUNTER_GET(i);
+        nrf_cli_print(p_cli, "%-16s %10u%s",
+                      p_counter->p_name,
+                      telemetry_counter_get(p_counter),
+                      (i < TELEMETRY_MAX_COUNTERS) ? "" : " (not sampled)");
+    }
+    nrf_cli_print(p_cli, "samples pending: %u, dropped: %u",
+                  m_wr_idx - m_rd_idx, m_dropped);
+}
+
+static void cmd_telemetry_list(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "timestamp");
+    for (size_t i = 0; i < counter_cnt(); i++)
+    {
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, " %s", TELEMETRY_COUNTER_GET(i)->p_name);
+    }
+    nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\n");
+}
+
+static void cmd_telemetry_dump(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    uint32_t rd = m_rd_idx;
+
+    while (rd != m_wr_idx)
+    {
+        uint32_t const * p_sample = m_samples[rd & (TELEMETRY_BUFFER_SAMPLES - 1)];
+
+        for (size_t i = 0; i < (1 + counter_cnt()); i++)
+        {
+            nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "%08x", p_sample[i]);
+        }
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\n");
+
+        /* Release the slot only after it was printed. */
+        __DMB();
+        m_rd_idx = ++rd;
+    }
+}
+
+static void cmd_telemetry_rate(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        nrf_cli_print(p_cli, "current interval: %u ms", m_interval_ms);
+        return;
+    }
+
+    if (argc != 2)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    char * p_end;
+    unsigned long interval = strtoul(argv[1], &p_end, 0);
+    if ((*p_end != '\0') ||
+        (interval == 0)   ||
+        (APP_TIMER_TICKS(interval) < APP_TIMER_MIN_TIMEOUT_TICKS))
+    {
+        nrf_cli_error(p_cli, "%s: bad interval: %s", argv[0], argv[1]);
+        return;
+    }
+
+    ret_code_t ret = app_timer_stop(m_sample_timer);
+    if (ret == NRF_SUCCESS)
+    {
+        m_interval_ms = (uint32_t)interval;
+        ret = app_timer_start(m_sample_timer, APP_TIMER_TICKS(m_interval_ms), NULL);
+    }
+    if (ret != NRF_SUCCESS)
+    {
+        nrf_cli_error(p_cli, "%s: failed to restart the timer (%u)", argv[0], ret);
+    }
+}
+
+static void cmd_telemetry(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_telemetry)
+{
+    NRF_CLI_CMD(dump, NULL, "Drain sampled values, one hex encoded sample per line.",
+                cmd_telemetry_dump),
+    NRF_CLI_CMD(list, NULL, "Print the layout of a dumped sample.", cmd_telemetry_list),
+    NRF_CLI_CMD(rate, NULL, "Set sampling interval in ms.", cmd_telemetry_rate),
+    NRF_CLI_CMD(show, NULL, "Print current counter values.", cmd_telemetry_show),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(telemetry, &m_sub_telemetry, "Telemetry counters", cmd_telemetry);
@@ -0,0 +1,90 @@
+/** @file
+ * @defgroup telemetry Telemetry counters
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Named counters that can be updated from any context and are sampled periodically into
+ *        a RAM ring buffer, instead of being formatted into log messages.
+ *
+ * Counters are registered with @ref TELEMETRY_COUNTER_DEF in the telemetry_counters section and
+ * updated with atomic operations, so interrupt handlers may use them without locking. An
+ * app_timer snapshots all counters every @ref TELEMETRY_SAMPLE_INTERVAL_MS milliseconds into a
+ * single producer/single consumer ring buffer. Samples are read on demand with the `telemetry`
+ * CLI command: `show` prints the current values, `dump` drains the ring buffer with one sample
+ * per line, each word printed as 8 hex digits without separators (app_timer timestamp followed by
+ * the counter values in `list` order).
+ */
+#ifndef TELEMETRY_H__
+#define TELEMETRY_H__
+
+#include <stdint.h>
+
+#include "sdk_errors.h"
+#include "app_util.h"
+#include "nrf_atomic.h"
+#include "nrf_section.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Counter descriptor, placed in flash. */
+typedef struct
+{
+    char const *       p_name;  //!< Counter name.
+    nrf_atomic_u32_t * p_value; //!< Counter value.
+} telemetry_counter_t;
+
+/**@brief Macro for defining a counter.
+ *
+ * @param _var  Counter variable name.
+ * @param _name Counter name, as printed by the CLI command.
+ */
+#define TELEMETRY_COUNTER_DEF(_var, _name)                                                  \
+    nrf_atomic_u32_t CONCAT_2(_var, _value);                                                \
+    NRF_SECTION_ITEM_REGISTER(telemetry_counters, telemetry_counter_t const _var) =         \
+    {                                                                                       \
+        .p_name  = (_name),                                                                 \
+        .p_value = &CONCAT_2(_var, _value),                                                 \
+    }
+
+/**@brief Macro for declaring a counter defined in another file. */
+#define TELEMETRY_COUNTER_DECLARE(_var) extern telemetry_counter_t const _var
+
+/**@brief Function for adding to a counter. Safe to call from interrupts. */
+static inline void telemetry_counter_add(telemetry_counter_t const * p_counter, uint32_t value)
+{
+    UNUSED_RETURN_VALUE(nrf_atomic_u32_add(p_counter->p_value, value));
+}
+
+/**@brief Function for incrementing a counter. Safe to call from interrupts. */
+static inline void telemetry_counter_inc(telemetry_counter_t const * p_counter)
+{
+    telemetry_counter_add(p_counter, 1);
+}
+
+/**@brief Function for resetting a counter. */
+static inline void telemetry_counter_reset(telemetry_counter_t const * p_counter)
+{
+    UNUSED_RETURN_VALUE(nrf_atomic_u32_store(p_counter->p_value, 0));
+}
+
+/**@brief Function for reading a counter. */
+static inline uint32_t telemetry_counter_get(telemetry_counter_t const * p_counter)
+{
+    return *p_counter->p_value;
+}
+
+/**@brief Function for initializing the module and starting the sampling timer.
+ *
+ * @note app_timer must be initialized first.
+ */
+ret_code_t telemetry_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TELEMETRY_H__
+
+/** @} */
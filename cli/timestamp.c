@@ -0,0 +1,204 @@
+#include "sdk_common.h"
+#include "timestamp.h"
+
+#include <string.h>
+
+#include "nrf.h"
+#include "app_timer.h"
+#include "app_util_platform.h"
+#include "nrf_cli.h"
+#include "timestamp_ext.h"
+
+#define RTC_FREQ    (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1))
+#define RTC_BITS    24
+
+APP_TIMER_DEF(m_sync_timer);
+
+static timestamp_ext_t    m_ext;
+static bool               m_started;
+static timestamp_source_t m_source = (timestamp_source_t)TIMESTAMP_SOURCE;
+static uint64_t           m_offset;     /* Keeps the time monotonic over source switches. */
+static uint64_t           m_last;
+
+static char const * const m_source_names[] =
+{
+    [TIMESTAMP_SOURCE_RTC]    = "rtc",
+    [TIMESTAMP_SOURCE_CYCCNT] = "cyccnt",
+    [TIMESTAMP_SOURCE_FUSED]  = "fused",
+};
+
+static uint64_t source_value(timestamp_source_t source)
+{
+    switch (source)
+    {
+        case TIMESTAMP_SOURCE_RTC:
+            return m_ext.rtc;
+        case TIMESTAMP_SOURCE_CYCCNT:
+            return m_ext.cyc;
+        default:
+            return m_ext.fused;
+    }
+}
+
+/* Must be called in a critical region. */
+static uint64_t update(void)
+{
+    if (!m_started)
+    {
+        return DWT->CYCCNT;
+    }
+
+    timestamp_ext_update(&m_ext, app_timer_cnt_get(), DWT->CYCCNT);
+
+    uint64_t now = source_value(m_source) + m_offset;
+
+    if (now < m_last)
+    {
+        now = m_last;
+    }
+    m_last = now;
+
+    return now;
+}
+
+uint64_t timestamp_get(void)
+{
+    uint64_t now;
+
+    CRITICAL_REGION_ENTER();
+    now = update();
+    CRITICAL_REGION_EXIT();
+
+    return now;
+}
+
+uint32_t timestamp_log_get(void)
+{
+    return (uint32_t)(timestamp_get() / (SystemCoreClock / TIMESTAMP_LOG_FREQ));
+}
+
+void timestamp_source_set(timestamp_source_t source)
+{
+    CRITICAL_REGION_ENTER();
+    uint64_t now = update();
+
+    m_source = source;
+    m_offset = 0;
+    if (m_started && (source_value(source) < now))
+    {
+        m_offset = now - source_value(source);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+static void sync_timer_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    UNUSED_RETURN_VALUE(timestamp_get());
+}
+
+ret_code_t timestamp_init(void)
+{
+    ret_code_t ret;
+
+    ret = app_timer_create(&m_sync_timer, APP_TIMER_MODE_REPEATED, sync_timer_handler);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    /* Continues from the cycles counted since reset. */
+    CRITICAL_REGION_ENTER();
+    uint32_t cyc = DWT->CYCCNT;
+
+    timestamp_ext_init(&m_ext, SystemCoreClock, RTC_FREQ, RTC_BITS,
+                       app_timer_cnt_get(), cyc, cyc);
+    m_last    = cyc;
+    m_started = true;
+    CRITICAL_REGION_EXIT();
+
+    return app_timer_start(m_sync_timer, APP_TIMER_TICKS(TIMESTAMP_SYNC_INTERVAL_MS), NULL);
+}
+
+static void time_print(nrf_cli_t const * p_cli, char const * p_name, uint64_t cycles)
+{
+    uint64_t us = cycles / (SystemCoreClock / 1000000);
+
+    nrf_cli_print(p_cli, "%-8s %6u.%06u s", p_name,
+                  (uint32_t)(us / 1000000), (uint32_t)(us % 1000000));
+}
+
+static void cmd_timestamp_show(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if (nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 1)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    timestamp_ext_t ext;
+    uint64_t        now = timestamp_get();
+
+    CRITICAL_REGION_ENTER();
+    ext = m_ext;
+    CRITICAL_REGION_EXIT();
+
+    nrf_cli_print(p_cli, "source: %s, %u resyncs to the RTC",
+                  m_source_names[m_source], ext.resyncs);
+    time_print(p_cli, "now", now);
+    time_print(p_cli, "rtc", ext.rtc);
+    time_print(p_cli, "cyccnt", ext.cyc);
+    time_print(p_cli, "fused", ext.fused);
+}
+
+static void cmd_timestamp_source(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    if (argc != 2)
+    {
+        nrf_cli_error(p_cli, "%s: bad parameter count", argv[0]);
+        return;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(m_source_names); i++)
+    {
+        if (!strcmp(argv[1], m_source_names[i]))
+        {
+            timestamp_source_set((timestamp_source_t)i);
+            return;
+        }
+    }
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+static void cmd_timestamp(nrf_cli_t const * p_cli, size_t argc, char **argv)
+{
+    if ((argc == 1) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    nrf_cli_error(p_cli, "%s: unknown parameter: %s", argv[0], argv[1]);
+}
+
+NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_sub_timestamp)
+{
+    NRF_CLI_CMD(show,   NULL, "Show the timestamps of all sources.", cmd_timestamp_show),
+    NRF_CLI_CMD(source, NULL, "Select the source: source <rtc|cyccnt|fused>.",
+                cmd_timestamp_source),
+    NRF_CLI_SUBCMD_SET_END
+};
+NRF_CLI_CMD_REGISTER(timestamp, &m_sub_timestamp, "Timestamp source", cmd_timestamp);
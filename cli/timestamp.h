@@ -0,0 +1,65 @@
+/** @file
+ * @defgroup timestamp 64-bit timestamp source
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Monotonic 64-bit timestamps in CPU cycles, for the logger and for profiling.
+ *
+ * Reads DWT CYCCNT and the app_timer RTC together and extends them with @ref timestamp_ext.
+ * The source is selected at runtime with @ref timestamp_source_set or the `timestamp` CLI
+ * command:
+ *
+ * - RTC: app_timer resolution, keeps counting while the CPU sleeps.
+ * - CYCCNT: cycle resolution, stops while the CPU sleeps.
+ * - fused (default): cycle resolution, resynchronized to the RTC after sleeping.
+ *
+ * Switching sources never makes the timestamp go backwards. An app_timer reads the counters
+ * every @ref TIMESTAMP_SYNC_INTERVAL_MS milliseconds, so that no wrap is missed while nothing
+ * else asks for the time. Before @ref timestamp_init the raw CYCCNT value is returned.
+ *
+ * The logger uses @ref timestamp_log_get, in microseconds: 32 bits wrap after 71 minutes instead
+ * of 67 seconds for raw CYCCNT. Decode binary logs with
+ * `log_decode.py --timestamp-freq 1000000 --timestamp-bits 32`.
+ */
+#ifndef TIMESTAMP_H__
+#define TIMESTAMP_H__
+
+#include <stdint.h>
+
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TIMESTAMP_LOG_FREQ  1000000 //!< Frequency of @ref timestamp_log_get.
+
+/**@brief Timestamp sources. */
+typedef enum
+{
+    TIMESTAMP_SOURCE_RTC,       //!< app_timer RTC.
+    TIMESTAMP_SOURCE_CYCCNT,    //!< DWT CYCCNT.
+    TIMESTAMP_SOURCE_FUSED,     //!< CYCCNT resynchronized to the RTC.
+} timestamp_source_t;
+
+/**@brief Function for starting the extension. app_timer must be initialized. */
+ret_code_t timestamp_init(void);
+
+/**@brief Function for selecting the source. */
+void timestamp_source_set(timestamp_source_t source);
+
+/**@brief Function for reading the timestamp, in CPU cycles since reset. Safe from any
+ *        context. */
+uint64_t timestamp_get(void);
+
+/**@brief Function for reading the lower 32 bits of the timestamp in microseconds. Timestamp
+ *        function of the logger, see @ref TIMESTAMP_LOG_FREQ. */
+uint32_t timestamp_log_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIMESTAMP_H__
+
+/** @} */
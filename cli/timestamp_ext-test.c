@@ -0,0 +1,192 @@
+/* Host test of the timestamp extension.
+ *
+ * Build and run on the host:
+ *   gcc -O2 -o timestamp_ext-test timestamp_ext-test.c timestamp_ext.c && ./timestamp_ext-test
+ *
+ * A simulated clock drives a 32-bit cycle counter at 64 MHz and a 24-bit RTC at 16384 Hz. The
+ * counters are sampled at random intervals, across several CYCCNT and RTC wraps, with and without
+ * the CPU sleeping, and the extended timestamps are compared with the simulated time.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "timestamp_ext.h"
+
+#define CPU_FREQ    64000000u
+#define RTC_FREQ    16384u
+#define RTC_BITS    24u
+#define TICK        (CPU_FREQ / RTC_FREQ)
+
+static unsigned m_fails;
+
+/* Simulated hardware. Time is kept in CPU cycles, the RTC runs from its own crystal with an
+   offset in ppm. */
+static uint64_t m_time;
+static uint64_t m_awake;            /* Cycles counted by CYCCNT. */
+static int32_t  m_rtc_ppm;
+static uint64_t m_rtc_phase;        /* Time of the RTC tick preceding time 0. */
+
+static void check(bool cond, char const * p_what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", p_what);
+        m_fails++;
+    }
+}
+
+static uint32_t rtc_read(void)
+{
+    double ticks = (double)(m_time + m_rtc_phase) * RTC_FREQ / CPU_FREQ;
+
+    ticks *= 1.0 + (m_rtc_ppm / 1e6);
+    return (uint32_t)(uint64_t)ticks & ((1u << RTC_BITS) - 1);
+}
+
+static uint32_t cyc_read(void)
+{
+    return (uint32_t)m_awake;
+}
+
+static void advance(uint64_t cycles, bool sleep)
+{
+    m_time += cycles;
+    if (!sleep)
+    {
+        m_awake += cycles;
+    }
+}
+
+static uint64_t rand_cycles(uint64_t max)
+{
+    return (((uint64_t)rand() << 31) ^ (uint64_t)rand()) % max;
+}
+
+static void sim_reset(uint64_t start, uint64_t phase, int32_t ppm)
+{
+    m_time      = start;
+    m_awake     = start;
+    m_rtc_phase = phase;
+    m_rtc_ppm   = ppm;
+}
+
+static int64_t abs64(int64_t v)
+{
+    return (v < 0) ? -v : v;
+}
+
+static void test_awake(void)
+{
+    timestamp_ext_t ext;
+    bool            exact     = true;
+    bool            monotonic = true;
+    uint64_t        prev      = 0;
+
+    /* Awake all the time, sampled from every few cycles to once every three CYCCNT wraps:
+       the fused time follows CYCCNT exactly, the number of wraps comes from the RTC. */
+    sim_reset(12345, 1000, 0);
+    timestamp_ext_init(&ext, CPU_FREQ, RTC_FREQ, RTC_BITS, rtc_read(), cyc_read(), m_time);
+
+    for (unsigned i = 0; i < 200000; i++)
+    {
+        uint64_t step = (i % 1000 == 999) ? rand_cycles(3 * (1ULL << 32)) : rand_cycles(100000);
+
+        advance(step, false);
+        timestamp_ext_update(&ext, rtc_read(), cyc_read());
+        exact     &= (ext.fused == m_time);
+        monotonic &= (ext.fused >= prev);
+        prev       = ext.fused;
+    }
+
+    printf("awake: %.0f s simulated, %u resyncs\r\n", (double)m_time / CPU_FREQ, ext.resyncs);
+    check(m_time > (2ULL << RTC_BITS) * TICK, "several RTC wraps simulated");
+    check(exact, "fused time follows CYCCNT across wraps");
+    check(monotonic, "fused time monotonic");
+    check(ext.resyncs == 0, "no resync while awake");
+    check(abs64((int64_t)(ext.rtc - m_time)) <= 2 * TICK, "RTC time within a tick");
+}
+
+static void test_cyccnt_only(void)
+{
+    timestamp_ext_t ext;
+    bool            exact = true;
+
+    /* Raw extension: exact as long as it is updated at least once per wrap. */
+    sim_reset(0, 0, 0);
+    timestamp_ext_init(&ext, CPU_FREQ, RTC_FREQ, RTC_BITS, rtc_read(), cyc_read(), 0);
+    for (unsigned i = 0; i < 100000; i++)
+    {
+        advance(rand_cycles(1ULL << 32), false);
+        timestamp_ext_update(&ext, rtc_read(), cyc_read());
+        exact &= (ext.cyc == m_awake);
+    }
+    check(exact, "CYCCNT extension exact with one update per wrap");
+}
+
+static void test_sleep(void)
+{
+    timestamp_ext_t ext;
+    bool            monotonic = true;
+    int64_t         err_max   = 0;
+    uint64_t        prev      = 0;
+
+    /* Sleeping stops CYCCNT, the fused time must follow the RTC. */
+    sim_reset(0, 2000, 0);
+    timestamp_ext_init(&ext, CPU_FREQ, RTC_FREQ, RTC_BITS, rtc_read(), cyc_read(), 0);
+    for (unsigned i = 0; i < 100000; i++)
+    {
+        advance(rand_cycles(200000), false);
+        advance(rand_cycles((i % 100 == 99) ? 64000000ULL * 100 : 500000), true);
+        advance(rand_cycles(200000), false);
+        timestamp_ext_update(&ext, rtc_read(), cyc_read());
+
+        int64_t err = abs64((int64_t)(ext.fused - m_time));
+
+        err_max    = (err > err_max) ? err : err_max;
+        monotonic &= (ext.fused >= prev);
+        prev       = ext.fused;
+    }
+
+    printf("sleep: %.0f s simulated, %.1f s awake, %u resyncs, max error %lld cycles\r\n",
+           (double)m_time / CPU_FREQ, (double)m_awake / CPU_FREQ, ext.resyncs,
+           (long long)err_max);
+    check(monotonic, "fused time monotonic with sleep");
+    check(err_max <= 5 * TICK, "fused time within a few ticks of real time");
+    check(ext.cyc == m_awake, "CYCCNT extension counts awake cycles only");
+}
+
+static void test_drift(void)
+{
+    timestamp_ext_t ext;
+    uint64_t        prev      = 0;
+    bool            monotonic = true;
+
+    /* 200 ppm between the clocks: short intervals keep cycle resolution, the fused time is
+       pulled back to the RTC when they drift apart. */
+    sim_reset(0, 0, 200);
+    timestamp_ext_init(&ext, CPU_FREQ, RTC_FREQ, RTC_BITS, rtc_read(), cyc_read(), 0);
+    for (unsigned i = 0; i < 100000; i++)
+    {
+        advance(rand_cycles(1000000), false);
+        timestamp_ext_update(&ext, rtc_read(), cyc_read());
+        monotonic &= (ext.fused >= prev);
+        prev       = ext.fused;
+    }
+
+    printf("drift: %u resyncs over %.0f s\r\n", ext.resyncs, (double)m_time / CPU_FREQ);
+    check(monotonic, "fused time monotonic with drift");
+    check(abs64((int64_t)(ext.fused - ext.rtc)) <= 4 * TICK, "fused time follows the RTC");
+}
+
+int main(void)
+{
+    printf("------------- Testing timestamp extension ---------------\r\n");
+    srand(1);
+    test_awake();
+    test_cyccnt_only();
+    test_sleep();
+    test_drift();
+    printf("%s\r\n", m_fails ? "FAILED" : "PASSED");
+    return m_fails ? 1 : 0;
+}
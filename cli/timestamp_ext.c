@@ -0,0 +1,70 @@
+#include "timestamp_ext.h"
+
+#define WRAP    (1ULL << 32)
+
+static uint64_t ticks_to_cycles(timestamp_ext_t const * p_ext, uint64_t ticks)
+{
+    /* Split to avoid overflowing 64 bits after a few months. */
+    return ((ticks / p_ext->rtc_freq) * p_ext->cpu_freq) +
+           (((ticks % p_ext->rtc_freq) * p_ext->cpu_freq) / p_ext->rtc_freq);
+}
+
+void timestamp_ext_init(timestamp_ext_t * p_ext,
+                        uint32_t          cpu_freq,
+                        uint32_t          rtc_freq,
+                        uint32_t          rtc_bits,
+                        uint32_t          rtc,
+                        uint32_t          cyc,
+                        uint64_t          start)
+{
+    p_ext->cpu_freq  = cpu_freq;
+    p_ext->rtc_freq  = rtc_freq;
+    p_ext->rtc_mask  = (rtc_bits < 32) ? ((1UL << rtc_bits) - 1) : UINT32_MAX;
+    p_ext->last_rtc  = rtc & p_ext->rtc_mask;
+    p_ext->last_cyc  = cyc;
+    p_ext->rtc_ticks = 0;
+    p_ext->start     = start;
+    p_ext->cyc       = start;
+    p_ext->rtc       = start;
+    p_ext->fused     = start;
+    p_ext->resyncs   = 0;
+}
+
+void timestamp_ext_update(timestamp_ext_t * p_ext, uint32_t rtc, uint32_t cyc)
+{
+    uint32_t dr = (rtc - p_ext->last_rtc) & p_ext->rtc_mask;
+    uint32_t dc = cyc - p_ext->last_cyc;
+
+    p_ext->last_rtc   = rtc & p_ext->rtc_mask;
+    p_ext->last_cyc   = cyc;
+    p_ext->rtc_ticks += dr;
+    p_ext->cyc       += dc;
+    p_ext->rtc        = p_ext->start + ticks_to_cycles(p_ext, p_ext->rtc_ticks);
+
+    /* Number of whole CYCCNT wraps that brings the fused time closest to the RTC time. */
+    uint64_t candidate = p_ext->fused + dc;
+    int64_t  diff      = (int64_t)(p_ext->rtc - candidate);
+
+    if (diff > (int64_t)(WRAP / 2))
+    {
+        candidate += ((uint64_t)diff + (WRAP / 2)) & ~(WRAP - 1);
+        diff       = (int64_t)(p_ext->rtc - candidate);
+    }
+
+    /* The RTC time is off by up to one tick each way, depending on the tick phase at
+       initialization, the fused time lags by up to one more tick after a resynchronization.
+       Anything beyond is sleep or drift between the clocks. */
+    uint64_t tolerance = 3 * ticks_to_cycles(p_ext, 1);
+    uint64_t fused     = candidate;
+
+    if ((uint64_t)((diff < 0) ? -diff : diff) > tolerance)
+    {
+        fused = p_ext->rtc;
+        p_ext->resyncs++;
+    }
+
+    if (fused > p_ext->fused)
+    {
+        p_ext->fused = fused;
+    }
+}
@@ -0,0 +1,82 @@
+/** @file
+ * @defgroup timestamp_ext Timestamp extension
+ * @{
+ * @ingroup CLI_example
+ *
+ * @brief Extends the 32-bit cycle counter and the RTC counter to 64-bit timestamps and fuses
+ *        them.
+ *
+ * DWT CYCCNT counts CPU cycles but wraps every 2^32 cycles (67 s at 64 MHz) and stops while the
+ * CPU sleeps. The RTC keeps running in sleep but has a resolution of one tick (61 us at
+ * 16384 Hz). Every update is given a snapshot of both counters and produces three timestamps,
+ * all in CPU cycles and all equal to the start value at initialization:
+ *
+ * - cyc: CYCCNT extended by counting wraps. Needs an update at least once per wrap. Does not
+ *   advance while the CPU sleeps.
+ * - rtc: RTC extended to 64 bits and converted to cycles. Needs an update at least once per RTC
+ *   period (1024 s for a 24-bit RTC at 16384 Hz).
+ * - fused: advances by the elapsed cycles, with the number of CYCCNT wraps taken from the RTC,
+ *   as long as the result agrees with the RTC within three ticks. Otherwise (CPU slept, clocks
+ *   drifted apart) it is resynchronized to the RTC. It has cycle resolution between
+ *   resynchronizations, stays within a few ticks of the RTC time and never goes backwards.
+ *
+ * The module has no SDK dependencies and is built on the host by timestamp_ext-test.c.
+ */
+#ifndef TIMESTAMP_EXT_H__
+#define TIMESTAMP_EXT_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Extension state. */
+typedef struct
+{
+    uint32_t cpu_freq;      //!< CYCCNT frequency in Hz.
+    uint32_t rtc_freq;      //!< RTC frequency in Hz.
+    uint32_t rtc_mask;      //!< RTC counter mask.
+    uint32_t last_rtc;      //!< RTC counter at the last update.
+    uint32_t last_cyc;      //!< CYCCNT at the last update.
+    uint64_t rtc_ticks;     //!< Extended RTC ticks since initialization.
+    uint64_t start;         //!< Timestamp at initialization.
+    uint64_t cyc;           //!< Extended CYCCNT timestamp.
+    uint64_t rtc;           //!< RTC timestamp, in cycles.
+    uint64_t fused;         //!< Fused timestamp.
+    uint32_t resyncs;       //!< Number of times the fused timestamp was set to the RTC time.
+} timestamp_ext_t;
+
+/**@brief Function for initializing the extension.
+ *
+ * @param[out] p_ext    Extension state.
+ * @param[in]  cpu_freq CYCCNT frequency in Hz.
+ * @param[in]  rtc_freq RTC frequency in Hz, at most @p cpu_freq.
+ * @param[in]  rtc_bits RTC counter width.
+ * @param[in]  rtc      Current RTC counter.
+ * @param[in]  cyc      Current CYCCNT.
+ * @param[in]  start    Initial value of the timestamps, in cycles.
+ */
+void timestamp_ext_init(timestamp_ext_t * p_ext,
+                        uint32_t          cpu_freq,
+                        uint32_t          rtc_freq,
+                        uint32_t          rtc_bits,
+                        uint32_t          rtc,
+                        uint32_t          cyc,
+                        uint64_t          start);
+
+/**@brief Function for updating the timestamps from a snapshot of both counters.
+ *
+ * @param[in,out] p_ext Extension state.
+ * @param[in]     rtc   Current RTC counter.
+ * @param[in]     cyc   Current CYCCNT, read together with @p rtc.
+ */
+void timestamp_ext_update(timestamp_ext_t * p_ext, uint32_t rtc, uint32_t cyc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIMESTAMP_EXT_H__
+
+/** @} */
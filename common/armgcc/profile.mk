@@ -0,0 +1,44 @@
+# Build profiles shared by the app Makefiles. Select one on the command line, for example
+#   make PROFILE=size_lto
+#
+#   speed     -O3 (default)
+#   size      -Os
+#   lto       -O3 with link time optimization
+#   size_lto  -Os with link time optimization
+#   debug     -Og, for stepping through the code with the debugger
+#
+# Every profile builds into its own output directory (_build for the default profile,
+# _build_<profile> otherwise), so switching profiles never mixes objects.
+# apps/build/profile_bench.py builds every profile and compares their size and speed.
+#
+# BENCH=1 builds with BENCH_ENABLED=1, which turns on the benchmarks of the apps, for example the
+# boot measurements read by profile_bench.py --run. Such a build goes to _build_bench or
+# _build_<profile>_bench.
+
+PROFILES := speed size lto size_lto debug
+PROFILE  ?= speed
+
+ifeq ($(filter $(PROFILE),$(PROFILES)),)
+$(error Unknown PROFILE $(PROFILE), use one of: $(PROFILES))
+endif
+
+ifeq ($(PROFILE),speed)
+PROFILE_SUFFIX :=
+else
+PROFILE_SUFFIX := _$(PROFILE)
+endif
+
+BENCH ?= 0
+ifeq ($(BENCH),1)
+PROFILE_SUFFIX := $(PROFILE_SUFFIX)_bench
+BENCH_CFLAGS   := -DBENCH_ENABLED=1
+endif
+
+OPT_speed    := -O3
+OPT_size     := -Os
+OPT_lto      := -O3 -flto
+OPT_size_lto := -Os -flto
+OPT_debug    := -Og
+
+# Debug information does not change the code, every profile keeps it.
+OPT = $(OPT_$(PROFILE)) -g3
@@ -0,0 +1,122 @@
+/* Host test of the benchmark statistics.
+ *
+ * Build and run on the host:
+ *   gcc -O2 -I. -I../host -I../../cli/config -o bench-test bench-test.c bench.c && ./bench-test
+ *
+ * The port is simulated: reading the time costs 3 units and the benchmark function advances the
+ * time by 100 + (call number % 64) units, so every run of 64 samples sees each cost once.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bench.h"
+
+static unsigned m_fails;
+
+static uint32_t m_time;
+static uint32_t m_calls;
+static uint32_t m_irq_depth;
+
+char const * const bench_port_unit         = "ticks";
+uint32_t const     bench_port_batch_factor = 1;
+
+void bench_port_init(void)
+{
+}
+
+uint32_t bench_port_time_get(void)
+{
+    uint32_t time = m_time;
+
+    m_time += 3;
+    return time;
+}
+
+uint32_t bench_port_irq_disable(void)
+{
+    return m_irq_depth++;
+}
+
+void bench_port_irq_restore(uint32_t state)
+{
+    m_irq_depth = state;
+}
+
+static void check(bool cond, char const * p_what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", p_what);
+        m_fails++;
+    }
+}
+
+static void fn(void * p_ctx)
+{
+    UNUSED_PARAMETER(p_ctx);
+
+    m_time += 100 + (m_calls++ % 64);
+}
+
+BENCH_DEF(single, fn, NULL, 1);
+BENCH_DEF(batch, fn, NULL, 4);
+
+static void line_print(void * p_ctx, char const * p_line)
+{
+    strncpy((char *)p_ctx, p_line, 255);
+}
+
+static bench_case_t const * case_find(char const * p_name)
+{
+    for (size_t i = 0; i < bench_count(); i++)
+    {
+        if (!strcmp(bench_get(i)->p_name, p_name))
+        {
+            return bench_get(i);
+        }
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    bench_result_t result;
+    char           line[256] = "";
+
+    check(bench_count() == 2, "two benchmarks registered");
+    check(case_find("single") && case_find("batch"), "benchmarks found by name");
+
+    /* Costs 100..163: mean 131.5, upper median 132, standard deviation 18.47. */
+    bench_run(case_find("single"), &result);
+    printf("single: min %u median %u mean %u max %u stddev %u overhead %u\r\n",
+           result.min, result.median, result.mean, result.max, result.stddev, result.overhead);
+    check(result.samples == BENCH_SAMPLES, "sample count");
+    check(result.batch == 1, "batch");
+    check(result.overhead == 3, "overhead of the time read");
+    check(result.min == 10000, "min");
+    check(result.median == 13200, "median");
+    check(result.mean == 13150, "mean");
+    check(result.max == 16300, "max");
+    check((result.stddev >= 1846) && (result.stddev <= 1848), "stddev");
+    check(m_irq_depth == 0, "interrupts restored");
+
+    /* Batches of 4 consecutive costs average out the spread. */
+    bench_run(case_find("batch"), &result);
+    printf("batch:  min %u median %u mean %u max %u stddev %u overhead %u\r\n",
+           result.min, result.median, result.mean, result.max, result.stddev, result.overhead);
+    check(result.batch == 4, "batch");
+    check(result.mean == 13150, "mean per call");
+    check(result.stddev < 1847, "smaller spread");
+
+    check(bench_run_all("batch", line_print, line) == 1, "filter selects one benchmark");
+    printf("%s\r\n", line);
+    check(strstr(line, "bench name=batch unit=ticks samples=64 batch=4 ") == line, "line format");
+    check(strstr(line, " mean=131.50 ") != NULL, "mean printed with two decimals");
+    check(bench_run_all("none", line_print, line) == 0, "unknown benchmark");
+    check(bench_run_all(NULL, line_print, line) == 2, "all benchmarks");
+
+    printf("%s\r\n", m_fails ? "FAILED" : "PASSED");
+    return m_fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
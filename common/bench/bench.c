@@ -0,0 +1,208 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BENCH)
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+NRF_SECTION_DEF(bench_cases, bench_case_t const);
+
+#define BENCH_CNT       NRF_SECTION_ITEM_COUNT(bench_cases, bench_case_t)
+#define BENCH_GET(i)    NRF_SECTION_ITEM_GET(bench_cases, bench_case_t const, (i))
+
+#define LINE_SIZE       192
+#define DIFF_MAX        (1ULL << 26)
+
+STATIC_ASSERT(BENCH_SAMPLES <= 4096);
+
+static uint32_t m_samples[BENCH_SAMPLES];
+
+/* Read once per sample, so that the compiler cannot inline the benchmark function into the
+   sampling loop of one run and not of the other. */
+static bench_fn_t volatile m_fn;
+
+static void empty(void * p_ctx)
+{
+    UNUSED_PARAMETER(p_ctx);
+    __asm volatile ("" ::: "memory");
+}
+
+static __attribute__((noinline)) uint32_t sample(void * p_ctx, uint32_t batch)
+{
+    bench_fn_t fn    = m_fn;
+    uint32_t   state = bench_port_irq_disable();
+    uint32_t   start = bench_port_time_get();
+
+    for (uint32_t i = 0; i < batch; i++)
+    {
+        fn(p_ctx);
+    }
+
+    uint32_t time = bench_port_time_get() - start;
+
+    bench_port_irq_restore(state);
+    return time;
+}
+
+static void samples_take(bench_fn_t fn, void * p_ctx, uint32_t batch)
+{
+    m_fn = fn;
+    for (uint32_t i = 0; i < BENCH_WARMUP; i++)
+    {
+        fn(p_ctx);
+    }
+    for (size_t i = 0; i < BENCH_SAMPLES; i++)
+    {
+        m_samples[i] = sample(p_ctx, batch);
+    }
+}
+
+static void samples_sort(void)
+{
+    for (size_t i = 1; i < BENCH_SAMPLES; i++)
+    {
+        uint32_t value = m_samples[i];
+        size_t   j     = i;
+
+        for (; (j > 0) && (m_samples[j - 1] > value); j--)
+        {
+            m_samples[j] = m_samples[j - 1];
+        }
+        m_samples[j] = value;
+    }
+}
+
+static uint32_t isqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit  = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root   = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+size_t bench_count(void)
+{
+    return BENCH_CNT;
+}
+
+bench_case_t const * bench_get(size_t idx)
+{
+    return BENCH_GET(idx);
+}
+
+void bench_run(bench_case_t const * p_case, bench_result_t * p_result)
+{
+    uint32_t batch = MAX(p_case->batch, 1) * bench_port_batch_factor;
+
+    bench_port_init();
+
+    /* Overhead: the fastest batch of empty calls. */
+    samples_take(empty, NULL, batch);
+    samples_sort();
+    uint32_t overhead = m_samples[0];
+
+    samples_take(p_case->fn, p_case->p_ctx, batch);
+    samples_sort();
+
+    /* Per call values, in hundredths of the time unit. */
+    uint64_t values[3];
+    uint64_t sum = 0;
+    size_t   idx[3] = { 0, BENCH_SAMPLES / 2, BENCH_SAMPLES - 1 };
+
+    for (size_t i = 0; i < BENCH_SAMPLES; i++)
+    {
+        m_samples[i] = (m_samples[i] > overhead) ? (m_samples[i] - overhead) : 0;
+        sum         += m_samples[i];
+    }
+    for (size_t i = 0; i < ARRAY_SIZE(values); i++)
+    {
+        values[i] = ((uint64_t)m_samples[idx[i]] * 100) / batch;
+    }
+
+    uint64_t mean     = (sum * 100) / ((uint64_t)BENCH_SAMPLES * batch);
+    uint64_t variance = 0;
+
+    for (size_t i = 0; i < BENCH_SAMPLES; i++)
+    {
+        uint64_t value = ((uint64_t)m_samples[i] * 100) / batch;
+        uint64_t diff  = (value > mean) ? (value - mean) : (mean - value);
+
+        /* Clamped to keep the sum within 64 bits, only matters for samples of seconds. */
+        diff      = MIN(diff, DIFF_MAX);
+        variance += diff * diff;
+    }
+    variance /= BENCH_SAMPLES;
+
+    p_result->samples  = BENCH_SAMPLES;
+    p_result->batch    = batch;
+    p_result->overhead = overhead;
+    p_result->min      = (uint32_t)values[0];
+    p_result->median   = (uint32_t)values[1];
+    p_result->max      = (uint32_t)values[2];
+    p_result->mean     = (uint32_t)mean;
+    p_result->stddev   = isqrt(variance);
+}
+
+size_t bench_format(char *                 p_buf,
+                    size_t                 size,
+                    bench_case_t const *   p_case,
+                    bench_result_t const * p_result)
+{
+    int len = snprintf(p_buf, size,
+                       "bench name=%s unit=%s samples=%u batch=%u "
+                       "min=%u.%02u median=%u.%02u mean=%u.%02u max=%u.%02u stddev=%u.%02u "
+                       "overhead=%u",
+                       p_case->p_name, bench_port_unit,
+                       (unsigned)p_result->samples, (unsigned)p_result->batch,
+                       (unsigned)(p_result->min / 100),    (unsigned)(p_result->min % 100),
+                       (unsigned)(p_result->median / 100), (unsigned)(p_result->median % 100),
+                       (unsigned)(p_result->mean / 100),   (unsigned)(p_result->mean % 100),
+                       (unsigned)(p_result->max / 100),    (unsigned)(p_result->max % 100),
+                       (unsigned)(p_result->stddev / 100), (unsigned)(p_result->stddev % 100),
+                       (unsigned)p_result->overhead);
+
+    return (len < 0) ? 0 : MIN((size_t)len, size - 1);
+}
+
+size_t bench_run_all(char const * p_filter, bench_print_t print, void * p_ctx)
+{
+    char   line[LINE_SIZE];
+    size_t cnt = 0;
+
+    for (size_t i = 0; i < BENCH_CNT; i++)
+    {
+        bench_case_t const * p_case = BENCH_GET(i);
+        bench_result_t       result;
+
+        if ((p_filter != NULL) && strcmp(p_filter, p_case->p_name))
+        {
+            continue;
+        }
+
+        bench_run(p_case, &result);
+        (void)bench_format(line, sizeof(line), p_case, &result);
+        print(p_ctx, line);
+        cnt++;
+    }
+
+    return cnt;
+}
+
+#endif // NRF_MODULE_ENABLED(BENCH)
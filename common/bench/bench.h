@@ -0,0 +1,166 @@
+/** @file
+ * @defgroup bench Micro-benchmarks
+ * @{
+ *
+ * @brief Benchmarks of hot paths, defined once and run on the dongle and on the host.
+ *
+ * A benchmark is a function running the code under test once, registered with @ref BENCH_DEF in
+ * the bench_cases section:
+ *
+ * @code
+ * static void bench_hsv_to_rgb(void * p_ctx)
+ * {
+ *     m_rgb = HsvToRgb(m_hsv);
+ *     m_hsv.h = (m_hsv.h + 1) % 360;
+ * }
+ *
+ * BENCH_DEF(hsv_to_rgb, bench_hsv_to_rgb, NULL, 1);
+ * @endcode
+ *
+ * A run calls the function @ref BENCH_WARMUP times to fill the caches and the branch predictor,
+ * then takes @ref BENCH_SAMPLES samples. A sample times a batch of calls with interrupts
+ * disabled. The time of a batch of calls to an empty function, measured the same way, is the
+ * overhead subtracted from every sample, so the results are the cost of the code under test per
+ * call, without the loop and the call itself. Every result is printed as one line:
+ *
+ *     bench name=hsv_to_rgb unit=cycles samples=64 batch=1 min=83.00 median=85.00 mean=85.42 max=97.00 stddev=2.13 overhead=9
+ *
+ * The time source is the port: bench_dwt.c counts CPU cycles with DWT CYCCNT on the target,
+ * bench_host.cpp counts nanoseconds with std::chrono::steady_clock on the host. The host clock
+ * has a coarse resolution and a high overhead compared to the code usually measured, so the host
+ * port multiplies the batch sizes by @ref bench_port_batch_factor.
+ *
+ * Define the bench_cases section in the linker script of the target app, the host linker provides
+ * it by itself.
+ */
+#ifndef BENCH_H__
+#define BENCH_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app_util.h"
+#include "nrf_section.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP    8       //!< Calls before the first sample.
+#endif
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES   64      //!< Samples per run.
+#endif
+
+/**@brief Benchmark function, runs the code under test once. */
+typedef void (*bench_fn_t)(void * p_ctx);
+
+/**@brief Benchmark descriptor, placed in flash. */
+typedef struct
+{
+    char const * p_name;    //!< Benchmark name.
+    bench_fn_t   fn;        //!< Benchmark function.
+    void *       p_ctx;     //!< Passed to the function.
+    uint32_t     batch;     //!< Calls per sample on the target.
+} bench_case_t;
+
+/**@brief Run result, per call of the benchmark function, in hundredths of the time unit. */
+typedef struct
+{
+    uint32_t samples;       //!< Number of samples.
+    uint32_t batch;         //!< Calls per sample.
+    uint32_t overhead;      //!< Overhead subtracted from every sample, in time units.
+    uint32_t min;
+    uint32_t median;
+    uint32_t mean;
+    uint32_t max;
+    uint32_t stddev;
+} bench_result_t;
+
+/**@brief Macro for defining a benchmark.
+ *
+ * @param _name  Benchmark name, printed in the results and used to select it.
+ * @param _fn    Benchmark function.
+ * @param _p_ctx Context passed to the function.
+ * @param _batch Calls per sample on the target, multiplied by the batch factor of the port.
+ */
+#define BENCH_DEF(_name, _fn, _p_ctx, _batch)                                               \
+    NRF_SECTION_ITEM_REGISTER(bench_cases, bench_case_t const CONCAT_2(bench_case_, _name)) = \
+    {                                                                                       \
+        .p_name     = STRINGIFY(_name),                                                     \
+        .fn         = (_fn),                                                                \
+        .p_ctx      = (_p_ctx),                                                             \
+        .batch      = (_batch),                                                             \
+    }
+
+/**@brief Function for printing a line of output, without the line ending. */
+typedef void (*bench_print_t)(void * p_ctx, char const * p_line);
+
+/**@brief Function for getting the number of benchmarks. */
+size_t bench_count(void);
+
+/**@brief Function for getting a benchmark.
+ *
+ * @param[in] idx Index, less than @ref bench_count.
+ */
+bench_case_t const * bench_get(size_t idx);
+
+/**@brief Function for running a benchmark.
+ *
+ * @param[in]  p_case   Benchmark.
+ * @param[out] p_result Result.
+ */
+void bench_run(bench_case_t const * p_case, bench_result_t * p_result);
+
+/**@brief Function for formatting a result as printed by @ref bench_run_all.
+ *
+ * @return Length of the line, truncated to @p size - 1 characters.
+ */
+size_t bench_format(char *                 p_buf,
+                    size_t                 size,
+                    bench_case_t const *   p_case,
+                    bench_result_t const * p_result);
+
+/**@brief Function for running the benchmarks and printing their results.
+ *
+ * @param[in] p_filter Name of the benchmark to run, NULL for all of them.
+ * @param[in] print    Output function.
+ * @param[in] p_ctx    Passed to @p print.
+ *
+ * @return Number of benchmarks run.
+ */
+size_t bench_run_all(char const * p_filter, bench_print_t print, void * p_ctx);
+
+/* Port: time source and interrupt masking, in bench_dwt.c or bench_host.cpp. */
+
+/**@brief Function for starting the time source. Called before every run. */
+void bench_port_init(void);
+
+/**@brief Function for reading the time source. */
+uint32_t bench_port_time_get(void);
+
+/**@brief Function for masking interrupts for the duration of a sample.
+ *
+ * @return State passed to @ref bench_port_irq_restore.
+ */
+uint32_t bench_port_irq_disable(void);
+
+/**@brief Function for restoring the interrupt mask. */
+void bench_port_irq_restore(uint32_t state);
+
+/**@brief Factor applied to the batch size of the benchmarks. */
+extern uint32_t const bench_port_batch_factor;
+
+/**@brief Unit of the time source, printed with the results. */
+extern char const * const bench_port_unit;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_H__
+
+/** @} */
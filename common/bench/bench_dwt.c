@@ -0,0 +1,42 @@
+#include "sdk_common.h"
+#include "bench_dwt.h"
+
+#include "nrf.h"
+
+void bench_dwt_enable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#if NRF_MODULE_ENABLED(BENCH)
+#include "bench.h"
+
+char const * const bench_port_unit         = "cycles";
+uint32_t const     bench_port_batch_factor = 1;
+
+void bench_port_init(void)
+{
+    /* CYCCNT is left running, timestamp.c and coop_sched.c use it too. */
+    bench_dwt_enable();
+}
+
+uint32_t bench_port_time_get(void)
+{
+    return DWT->CYCCNT;
+}
+
+uint32_t bench_port_irq_disable(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    return primask;
+}
+
+void bench_port_irq_restore(uint32_t state)
+{
+    __set_PRIMASK(state);
+}
+
+#endif // NRF_MODULE_ENABLED(BENCH)
@@ -0,0 +1,22 @@
+/** @file
+ * @brief DWT cycle counter, shared by the benchmark port and the modules timing with CYCCNT.
+ */
+#ifndef BENCH_DWT_H__
+#define BENCH_DWT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for starting the CYCCNT cycle counter.
+ *
+ * The counter is neither stopped nor reset afterwards, other users may rely on it. Calling the
+ * function again has no effect.
+ */
+void bench_dwt_enable(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_DWT_H__
@@ -0,0 +1,37 @@
+#include "bench.h"
+
+#include <chrono>
+
+#ifndef BENCH_HOST_BATCH_FACTOR
+#define BENCH_HOST_BATCH_FACTOR 64
+#endif
+
+extern "C" {
+
+char const * const bench_port_unit         = "ns";
+uint32_t const     bench_port_batch_factor = BENCH_HOST_BATCH_FACTOR;
+
+void bench_port_init(void)
+{
+}
+
+uint32_t bench_port_time_get(void)
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+    /* Differences of the low 32 bits are right for samples shorter than 4 s. */
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+/* A process cannot mask interrupts, samples preempted by the OS show up in max and stddev. */
+uint32_t bench_port_irq_disable(void)
+{
+    return 0;
+}
+
+void bench_port_irq_restore(uint32_t state)
+{
+    static_cast<void>(state);
+}
+
+} // extern "C"
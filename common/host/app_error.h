@@ -0,0 +1,23 @@
+/** @file
+ * @brief Host shim: errors abort the program.
+ */
+#ifndef APP_ERROR_H__
+#define APP_ERROR_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sdk_errors.h"
+
+#define APP_ERROR_CHECK(err_code)                                                        \
+    do                                                                                   \
+    {                                                                                    \
+        ret_code_t const local_err_code = (err_code);                                    \
+        if (local_err_code != NRF_SUCCESS)                                               \
+        {                                                                                \
+            fprintf(stderr, "%s:%d: error 0x%x\n", __FILE__, __LINE__, local_err_code);  \
+            abort();                                                                     \
+        }                                                                                \
+    } while (0)
+
+#endif // APP_ERROR_H__
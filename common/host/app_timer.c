@@ -0,0 +1,111 @@
+#include "app_timer.h"
+
+#include <stddef.h>
+
+#define RTC_MASK 0x00FFFFFF
+
+static uint64_t      m_now;
+static app_timer_t * mp_active;     /* Active timers, in no particular order. */
+
+static void list_remove(app_timer_t * p_timer)
+{
+    for (app_timer_t ** pp = &mp_active; *pp != NULL; pp = &(*pp)->p_next)
+    {
+        if (*pp == p_timer)
+        {
+            *pp = p_timer->p_next;
+            break;
+        }
+    }
+    p_timer->active = false;
+}
+
+ret_code_t app_timer_init(void)
+{
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_create(app_timer_id_t const *      p_timer_id,
+                            app_timer_mode_t            mode,
+                            app_timer_timeout_handler_t timeout_handler)
+{
+    if ((timeout_handler == NULL) || ((*p_timer_id)->active))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    (*p_timer_id)->handler = timeout_handler;
+    (*p_timer_id)->mode    = mode;
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void * p_context)
+{
+    if ((timeout_ticks < APP_TIMER_MIN_TIMEOUT_TICKS) || (timer_id->handler == NULL))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    /* Restarting a running timer is ignored by app_timer2 as well. */
+    if (!timer_id->active)
+    {
+        timer_id->expiry    = m_now + timeout_ticks;
+        timer_id->period    = timeout_ticks;
+        timer_id->p_context = p_context;
+        timer_id->active    = true;
+        timer_id->p_next    = mp_active;
+        mp_active           = timer_id;
+    }
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_stop(app_timer_id_t timer_id)
+{
+    list_remove(timer_id);
+    return NRF_SUCCESS;
+}
+
+uint32_t app_timer_cnt_get(void)
+{
+    return (uint32_t)m_now & RTC_MASK;
+}
+
+uint32_t app_timer_cnt_diff_compute(uint32_t ticks_to, uint32_t ticks_from)
+{
+    return (ticks_to - ticks_from) & RTC_MASK;
+}
+
+void app_timer_host_advance(uint32_t ticks)
+{
+    uint64_t end = m_now + ticks;
+
+    while (true)
+    {
+        app_timer_t * p_next = NULL;
+
+        for (app_timer_t * p = mp_active; p != NULL; p = p->p_next)
+        {
+            if ((p->expiry <= end) && ((p_next == NULL) || (p->expiry < p_next->expiry)))
+            {
+                p_next = p;
+            }
+        }
+        if (p_next == NULL)
+        {
+            break;
+        }
+
+        m_now = p_next->expiry;
+        if (p_next->mode == APP_TIMER_MODE_REPEATED)
+        {
+            p_next->expiry += p_next->period;
+        }
+        else
+        {
+            list_remove(p_next);
+        }
+        p_next->handler(p_next->p_context);
+    }
+
+    m_now = end;
+}
@@ -0,0 +1,70 @@
+/** @file
+ * @brief Host shim: app_timer on a simulated RTC.
+ *
+ * Time only advances when the host program calls @ref app_timer_host_advance, which runs the
+ * handlers of the expired timers in expiry order, so timer driven code runs deterministically
+ * and as fast as the host allows.
+ */
+#ifndef APP_TIMER_H__
+#define APP_TIMER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sdk_config.h"
+#include "sdk_errors.h"
+#include "app_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APP_TIMER_CLOCK_FREQ            32768
+#define APP_TIMER_MIN_TIMEOUT_TICKS     5
+
+#define APP_TIMER_TICKS(MS)                                                     \
+    ((uint32_t)ROUNDED_DIV((MS) * (uint64_t)APP_TIMER_CLOCK_FREQ,               \
+                           1000 * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)))
+
+typedef void (*app_timer_timeout_handler_t)(void * p_context);
+
+typedef enum
+{
+    APP_TIMER_MODE_SINGLE_SHOT,
+    APP_TIMER_MODE_REPEATED
+} app_timer_mode_t;
+
+typedef struct app_timer_s
+{
+    struct app_timer_s *        p_next;
+    app_timer_timeout_handler_t handler;
+    app_timer_mode_t            mode;
+    uint64_t                    expiry;
+    uint32_t                    period;
+    void *                      p_context;
+    bool                        active;
+} app_timer_t;
+
+typedef app_timer_t * app_timer_id_t;
+
+#define APP_TIMER_DEF(timer_id)                                 \
+    static app_timer_t CONCAT_2(timer_id, _data);               \
+    static app_timer_id_t const timer_id = &CONCAT_2(timer_id, _data)
+
+ret_code_t app_timer_init(void);
+ret_code_t app_timer_create(app_timer_id_t const *      p_timer_id,
+                            app_timer_mode_t            mode,
+                            app_timer_timeout_handler_t timeout_handler);
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void * p_context);
+ret_code_t app_timer_stop(app_timer_id_t timer_id);
+uint32_t app_timer_cnt_get(void);
+uint32_t app_timer_cnt_diff_compute(uint32_t ticks_to, uint32_t ticks_from);
+
+/**@brief Function for advancing the simulated RTC and running the expired timers. */
+void app_timer_host_advance(uint32_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMER_H__
@@ -0,0 +1,110 @@
+#include "app_usbd_cdc_acm.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static void event_put(app_usbd_cdc_acm_host_ctx_t * p_ctx, app_usbd_cdc_acm_user_event_t event)
+{
+    assert((p_ctx->evt_wr - p_ctx->evt_rd) < APP_USBD_CDC_ACM_HOST_EVENTS);
+    p_ctx->events[p_ctx->evt_wr++ % APP_USBD_CDC_ACM_HOST_EVENTS] = event;
+}
+
+/* Copies the received bytes to the pending read buffer if there are enough of them. */
+static bool read_complete(app_usbd_cdc_acm_host_ctx_t * p_ctx, void * p_buf, size_t length)
+{
+    if ((p_ctx->rx_wr - p_ctx->rx_rd) < length)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        ((uint8_t *)p_buf)[i] = p_ctx->rx[p_ctx->rx_rd++ % APP_USBD_CDC_ACM_HOST_RX_SIZE];
+    }
+    p_ctx->rx_size = length;
+    return true;
+}
+
+ret_code_t app_usbd_cdc_acm_write(app_usbd_cdc_acm_t const * p_cdc_acm,
+                                  void const *               p_buf,
+                                  size_t                     length)
+{
+    fwrite(p_buf, 1, length, stdout);
+    p_cdc_acm->p_ctx->tx_bytes += length;
+
+    /* Back-to-back writes complete with a single event. */
+    if (!p_cdc_acm->p_ctx->tx_done_pending)
+    {
+        p_cdc_acm->p_ctx->tx_done_pending = true;
+        event_put(p_cdc_acm->p_ctx, APP_USBD_CDC_ACM_USER_EVT_TX_DONE);
+    }
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_usbd_cdc_acm_read(app_usbd_cdc_acm_t const * p_cdc_acm,
+                                 void *                     p_buf,
+                                 size_t                     length)
+{
+    app_usbd_cdc_acm_host_ctx_t * p_ctx = p_cdc_acm->p_ctx;
+
+    if (p_ctx->p_read_buf != NULL)
+    {
+        return NRF_ERROR_BUSY;
+    }
+    if (read_complete(p_ctx, p_buf, length))
+    {
+        return NRF_SUCCESS;
+    }
+
+    p_ctx->p_read_buf = p_buf;
+    p_ctx->read_len   = length;
+    return NRF_ERROR_IO_PENDING;
+}
+
+size_t app_usbd_cdc_acm_rx_size(app_usbd_cdc_acm_t const * p_cdc_acm)
+{
+    return p_cdc_acm->p_ctx->rx_size;
+}
+
+void app_usbd_cdc_acm_host_port_set(app_usbd_cdc_acm_t const * p_cdc_acm, bool open)
+{
+    event_put(p_cdc_acm->p_ctx,
+              open ? APP_USBD_CDC_ACM_USER_EVT_PORT_OPEN : APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE);
+}
+
+size_t app_usbd_cdc_acm_host_rx(app_usbd_cdc_acm_t const * p_cdc_acm,
+                                void const *               p_data,
+                                size_t                     length)
+{
+    app_usbd_cdc_acm_host_ctx_t * p_ctx = p_cdc_acm->p_ctx;
+    size_t                        count = 0;
+
+    while ((count < length) && ((p_ctx->rx_wr - p_ctx->rx_rd) < APP_USBD_CDC_ACM_HOST_RX_SIZE))
+    {
+        p_ctx->rx[p_ctx->rx_wr++ % APP_USBD_CDC_ACM_HOST_RX_SIZE] = ((uint8_t const *)p_data)[count++];
+    }
+
+    if ((p_ctx->p_read_buf != NULL) && read_complete(p_ctx, p_ctx->p_read_buf, p_ctx->read_len))
+    {
+        p_ctx->p_read_buf = NULL;
+        event_put(p_ctx, APP_USBD_CDC_ACM_USER_EVT_RX_DONE);
+    }
+    return count;
+}
+
+bool app_usbd_cdc_acm_host_event_get(app_usbd_cdc_acm_t const *      p_cdc_acm,
+                                     app_usbd_cdc_acm_user_event_t * p_event)
+{
+    app_usbd_cdc_acm_host_ctx_t * p_ctx = p_cdc_acm->p_ctx;
+
+    if (p_ctx->evt_rd == p_ctx->evt_wr)
+    {
+        return false;
+    }
+    *p_event = p_ctx->events[p_ctx->evt_rd++ % APP_USBD_CDC_ACM_HOST_EVENTS];
+    if (*p_event == APP_USBD_CDC_ACM_USER_EVT_TX_DONE)
+    {
+        p_ctx->tx_done_pending = false;
+    }
+    return true;
+}
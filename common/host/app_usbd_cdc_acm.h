@@ -0,0 +1,93 @@
+/** @file
+ * @brief Host shim: CDC ACM class without USB.
+ *
+ * The host program plays the USB host: it opens the port and feeds received bytes with the
+ * app_usbd_cdc_acm_host_* functions, and passes the queued user events to the app, as the event
+ * handler registered with APP_USBD_CDC_ACM_GLOBAL_DEF would get them. Transmitted data is written
+ * to stdout and completes immediately, writes done before the TX_DONE event is handled share it.
+ */
+#ifndef APP_USBD_CDC_ACM_H__
+#define APP_USBD_CDC_ACM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdk_errors.h"
+#include "app_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRFX_USBD_EPSIZE                    64
+#define APP_USBD_CDC_ACM_HOST_RX_SIZE       256 //!< Received bytes not read yet.
+#define APP_USBD_CDC_ACM_HOST_EVENTS        64  //!< Events not handled yet.
+
+typedef enum
+{
+    APP_USBD_CDC_ACM_USER_EVT_RX_DONE,
+    APP_USBD_CDC_ACM_USER_EVT_TX_DONE,
+    APP_USBD_CDC_ACM_USER_EVT_PORT_OPEN,
+    APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE,
+} app_usbd_cdc_acm_user_event_t;
+
+typedef struct
+{
+    uint8_t                       rx[APP_USBD_CDC_ACM_HOST_RX_SIZE];
+    size_t                        rx_rd;
+    size_t                        rx_wr;
+    void *                        p_read_buf;   //!< Pending read, NULL if none.
+    size_t                        read_len;
+    size_t                        rx_size;      //!< Size of the last completed read.
+    app_usbd_cdc_acm_user_event_t events[APP_USBD_CDC_ACM_HOST_EVENTS];
+    size_t                        evt_rd;
+    size_t                        evt_wr;
+    size_t                        tx_bytes;
+    bool                          tx_done_pending;
+} app_usbd_cdc_acm_host_ctx_t;
+
+typedef struct
+{
+    app_usbd_cdc_acm_host_ctx_t * p_ctx;
+} app_usbd_cdc_acm_t;
+
+/**@brief Macro for defining a CDC ACM instance on the host. */
+#define APP_USBD_CDC_ACM_HOST_DEF(name)                                 \
+    static app_usbd_cdc_acm_host_ctx_t CONCAT_2(name, _ctx);            \
+    static app_usbd_cdc_acm_t const name = { .p_ctx = &CONCAT_2(name, _ctx) }
+
+ret_code_t app_usbd_cdc_acm_write(app_usbd_cdc_acm_t const * p_cdc_acm,
+                                  void const *               p_buf,
+                                  size_t                     length);
+
+ret_code_t app_usbd_cdc_acm_read(app_usbd_cdc_acm_t const * p_cdc_acm,
+                                 void *                     p_buf,
+                                 size_t                     length);
+
+size_t app_usbd_cdc_acm_rx_size(app_usbd_cdc_acm_t const * p_cdc_acm);
+
+/**@brief Function for opening or closing the port, queues PORT_OPEN or PORT_CLOSE. */
+void app_usbd_cdc_acm_host_port_set(app_usbd_cdc_acm_t const * p_cdc_acm, bool open);
+
+/**@brief Function for receiving data. Completes the pending read with an RX_DONE event.
+ *
+ * @return Number of bytes accepted, less than @p length if the receive buffer is full.
+ */
+size_t app_usbd_cdc_acm_host_rx(app_usbd_cdc_acm_t const * p_cdc_acm,
+                                void const *               p_data,
+                                size_t                     length);
+
+/**@brief Function for getting the next user event.
+ *
+ * @retval true  Event available.
+ * @retval false No event queued.
+ */
+bool app_usbd_cdc_acm_host_event_get(app_usbd_cdc_acm_t const *      p_cdc_acm,
+                                     app_usbd_cdc_acm_user_event_t * p_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_USBD_CDC_ACM_H__
@@ -0,0 +1,33 @@
+/** @file
+ * @brief Host shim: the utility macros of app_util.h used by the apps.
+ */
+#ifndef APP_UTIL_H__
+#define APP_UTIL_H__
+
+#include <stdint.h>
+
+#define STRINGIFY_(val)             #val
+#define STRINGIFY(val)              STRINGIFY_(val)
+#define CONCAT_2_(p1, p2)           p1##p2
+#define CONCAT_2(p1, p2)            CONCAT_2_(p1, p2)
+#define CONCAT_3_(p1, p2, p3)       p1##p2##p3
+#define CONCAT_3(p1, p2, p3)        CONCAT_3_(p1, p2, p3)
+
+#define ARRAY_SIZE(arr)             (sizeof(arr) / sizeof((arr)[0]))
+#define STATIC_ASSERT(expr)         _Static_assert((expr), #expr)
+#define IS_POWER_OF_TWO(a)          (((a) != 0) && ((((a) - 1) & (a)) == 0))
+#define ROUNDED_DIV(a, b)           (((a) + ((b) / 2)) / (b))
+#define CEIL_DIV(a, b)              ((((a) - 1) / (b)) + 1)
+
+#define UNUSED_VARIABLE(x)          ((void)(x))
+#define UNUSED_PARAMETER(x)         ((void)(x))
+#define UNUSED_RETURN_VALUE(x)      ((void)(x))
+
+#ifndef MIN
+#define MIN(a, b)                   (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)                   (((a) > (b)) ? (a) : (b))
+#endif
+
+#endif // APP_UTIL_H__
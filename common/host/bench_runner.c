@@ -0,0 +1,46 @@
+/** @file
+ * @brief Host runner of the micro-benchmarks, see common/bench/bench.h and Makefile.
+ *
+ * Runs the benchmarks named on the command line, all of them without arguments, and prints one
+ * result line per benchmark, in the format of the `bench run` CLI command on the dongle. `-l`
+ * lists the benchmarks instead.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static void line_print(void * p_ctx, char const * p_line)
+{
+    UNUSED_PARAMETER(p_ctx);
+    printf("%s\n", p_line);
+    fflush(stdout);
+}
+
+int main(int argc, char ** argv)
+{
+    if ((argc == 2) && !strcmp(argv[1], "-l"))
+    {
+        for (size_t i = 0; i < bench_count(); i++)
+        {
+            printf("%-24s batch %u\n", bench_get(i)->p_name, bench_get(i)->batch);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (argc == 1)
+    {
+        bench_run_all(NULL, line_print, NULL);
+    }
+    for (int i = 1; i < argc; i++)
+    {
+        if (bench_run_all(argv[i], line_print, NULL) == 0)
+        {
+            fprintf(stderr, "%s: unknown benchmark\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
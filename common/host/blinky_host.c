@@ -0,0 +1,85 @@
+/** @file
+ * @brief Host build of blinky_freertos on the FreeRTOS POSIX port, see Makefile.
+ *
+ * main() of the app runs unchanged, renamed, with the GPIO shim as LEDs and periodic_work on
+ * software timers. The FreeRTOS tick of the POSIX port follows the wall clock. A monitor task,
+ * created before the app starts the scheduler, lets the app run for the time given on the command
+ * line, 5000 ms by default:
+ *
+ *     _build/blinky_freertos [ms]
+ *
+ * It then prints the toggles of every LED against the ones expected from the periods of the app
+ * and exits with status 1 when a blinking LED is off by more than one toggle, or when the error
+ * LED toggled at all, so a CI job catches changes of the scheduling or of the periods. The error
+ * mode never returns: when it is entered before the monitor task runs, the program hangs, the
+ * make check recipe runs it with a timeout.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The app, with its defines and its static functions. */
+#define main blinky_main
+#include "main.c"
+#undef main
+
+#define MONITOR_PRIORITY    (configMAX_PRIORITIES - 1)
+#define MONITOR_STACK       configMINIMAL_STACK_SIZE
+#define RUN_MS_DEFAULT      5000
+
+static StaticTask_t m_monitor_tcb;
+static StackType_t  m_monitor_stack[MONITOR_STACK];
+static uint32_t     m_run_ms = RUN_MS_DEFAULT;
+
+/* Checks the toggles of a LED since start, allowing the given difference to the expected count. */
+static bool led_check(char const * p_name,
+                      uint32_t     pin,
+                      uint32_t     start,
+                      uint32_t     expected,
+                      uint32_t     slack)
+{
+    uint32_t toggles = nrf_gpio_host_changes_get(pin) - start;
+    bool     ok      = (toggles + slack >= expected) && (toggles <= expected + slack);
+
+    printf("%-8s %u toggles, %u expected%s\n", p_name, toggles, expected, ok ? "" : ", FAILED");
+    return ok;
+}
+
+static void monitor_task(void * p_context)
+{
+    /* The initial writes of main() are not toggles. */
+    uint32_t led1_start  = nrf_gpio_host_changes_get(LED1_G);
+    uint32_t led2_start  = nrf_gpio_host_changes_get(LED2_G);
+    uint32_t error_start = nrf_gpio_host_changes_get(LED2_R);
+    uint32_t ticks       = pdMS_TO_TICKS(m_run_ms);
+    bool     ok          = true;
+
+    (void)p_context;
+
+    vTaskDelay(ticks);
+
+    printf("ran %u ms, %u ticks\n", m_run_ms, ticks);
+    /* LED1_G every TASK_DELAY ticks, LED2_G every LED2_PERIOD ms, one more or less depending on
+       where the run ends in the period. */
+    ok &= led_check("LED1_G", LED1_G, led1_start, ticks / TASK_DELAY, 1);
+    ok &= led_check("LED2_G", LED2_G, led2_start, m_run_ms / LED2_PERIOD, 1);
+    /* LED2_R only blinks in the error mode, a single toggle is an error. */
+    ok &= led_check("LED2_R", LED2_R, error_start, 0, 0);
+
+    fflush(stdout);
+    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main(int argc, char * argv[])
+{
+    if (argc > 1)
+    {
+        m_run_ms = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    (void)xTaskCreateStatic(monitor_task, "MON", MONITOR_STACK, NULL, MONITOR_PRIORITY,
+                            m_monitor_stack, &m_monitor_tcb);
+
+    /* Does not return, unless the scheduler cannot start. */
+    blinky_main();
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,68 @@
+/** @file
+ * @brief Host build of the usbd_cdc_acm echo console, see Makefile.
+ *
+ * Opens the port, sends stdin to the console as a terminal would (newlines as carriage returns)
+ * and hands the CDC ACM user events to cdc_console_event_handle() one by one, as the main loop of
+ * the app does. The echo is written to stdout. At the end the port is closed and the number of
+ * changes of every LED is printed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "app_usbd_cdc_acm.h"
+#include "cdc_console.h"
+#include "nrf_gpio.h"
+#include "pca10059.h"
+
+APP_USBD_CDC_ACM_HOST_DEF(m_cdc);
+
+static void events_handle(void)
+{
+    app_usbd_cdc_acm_user_event_t event;
+
+    while (app_usbd_cdc_acm_host_event_get(&m_cdc, &event))
+    {
+        cdc_console_event_handle(&m_cdc, event);
+    }
+}
+
+static void led_print(char const * p_name, uint32_t pin)
+{
+    printf("%-16s %s, %u changes\r\n", p_name, nrf_gpio_pin_out_read(pin) ? "off" : "on",
+           nrf_gpio_host_changes_get(pin));
+}
+
+int main(void)
+{
+    int c;
+
+    /* As in main() of the app, all LEDs off. */
+    nrf_gpio_cfg_output(LED_USB_RESUME);   nrf_gpio_pin_write(LED_USB_RESUME, 1);
+    nrf_gpio_cfg_output(LED_CDC_ACM_OPEN); nrf_gpio_pin_write(LED_CDC_ACM_OPEN, 1);
+    nrf_gpio_cfg_output(LED_CDC_ACM_RX);   nrf_gpio_pin_write(LED_CDC_ACM_RX, 1);
+    nrf_gpio_cfg_output(LED_CDC_ACM_TX);   nrf_gpio_pin_write(LED_CDC_ACM_TX, 1);
+
+    app_usbd_cdc_acm_host_port_set(&m_cdc, true);
+    events_handle();
+
+    while ((c = getchar()) != EOF)
+    {
+        uint8_t byte = (c == '\n') ? '\r' : (uint8_t)c;
+
+        while (app_usbd_cdc_acm_host_rx(&m_cdc, &byte, 1) == 0)
+        {
+            events_handle();
+        }
+        events_handle();
+    }
+
+    app_usbd_cdc_acm_host_port_set(&m_cdc, false);
+    events_handle();
+
+    printf("\r\n");
+    led_print("LED_USB_RESUME", LED_USB_RESUME);
+    led_print("LED_CDC_ACM_OPEN", LED_CDC_ACM_OPEN);
+    led_print("LED_CDC_ACM_RX", LED_CDC_ACM_RX);
+    led_print("LED_CDC_ACM_TX", LED_CDC_ACM_TX);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+/** @file
+ * @brief Host build of the cli app command handlers, see Makefile.
+ *
+ * Executes the command lines read from stdin, or from the files given as arguments, with the
+ * command handlers of demo_cli_cmds.c, demo_cli_cmds_cpp.cpp and telemetry.c. Empty lines and
+ * lines starting with '#' are skipped. Input that is not a terminal is echoed after the prompt,
+ * so the output of a script reads like a session. One host command is added:
+ *
+ *     host_sleep <ms>   advance app_timer by ms milliseconds, running the timer handlers
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "app_error.h"
+#include "app_timer.h"
+#include "coop_sched.h"
+#include "nrf_cli.h"
+
+#define LINE_SIZE 256
+
+/* From the app sources. */
+ret_code_t demo_cli_counter_init(void);
+ret_code_t telemetry_init(void);
+
+NRF_CLI_DEF(m_cli, "cli:~$ ", &nrf_cli_host_transport, '\n', 0);
+
+static void cmd_host_sleep(nrf_cli_t const * p_cli, size_t argc, char ** argv)
+{
+    if ((argc != 2) || nrf_cli_help_requested(p_cli))
+    {
+        nrf_cli_help_print(p_cli, NULL, 0);
+        return;
+    }
+
+    app_timer_host_advance(APP_TIMER_TICKS(strtoul(argv[1], NULL, 0)));
+}
+
+NRF_CLI_CMD_REGISTER(host_sleep, NULL, "Advance the time: host_sleep <ms>", cmd_host_sleep);
+
+static void run(FILE * p_in)
+{
+    char line[LINE_SIZE];
+    bool echo = !isatty(fileno(p_in));
+
+    for (;;)
+    {
+        fputs(m_cli.p_name, stdout);
+        if (fgets(line, sizeof(line), p_in) == NULL)
+        {
+            break;
+        }
+        if (echo)
+        {
+            fputs(line, stdout);
+        }
+        /* The line is tokenized in place, the command is its first token afterwards. */
+        if ((line[0] != '#') && !nrf_cli_host_execute(&m_cli, line))
+        {
+            nrf_cli_error(&m_cli, "%s: command not found", line);
+        }
+        /* Commands like bench run finish in deferred work. */
+        coop_sched_run();
+        fflush(stdout);
+    }
+    putchar('\n');
+}
+
+int main(int argc, char ** argv)
+{
+    APP_ERROR_CHECK(app_timer_init());
+    APP_ERROR_CHECK(demo_cli_counter_init());
+    APP_ERROR_CHECK(telemetry_init());
+
+    if (argc == 1)
+    {
+        run(stdin);
+    }
+    for (int i = 1; i < argc; i++)
+    {
+        FILE * p_in = fopen(argv[i], "r");
+
+        if (p_in == NULL)
+        {
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+        run(p_in);
+        fclose(p_in);
+    }
+
+    return (m_cli.p_ctx->errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,53 @@
+/** @file
+ * @brief Host shim: deferred work of the coop_sched main loop scheduler of cli.
+ *
+ * There are no slots and no budgets on the host. coop_sched_run() resumes the queued handlers
+ * until all of them have finished, cli_host.c calls it after every command line, so the output
+ * of a deferred command is complete before the next prompt.
+ */
+#include "coop_sched.h"
+
+#include <assert.h>
+
+#define QUEUE_SIZE 4
+
+typedef struct
+{
+    coop_sched_work_t handler;
+    void *            p_context;
+} work_t;
+
+static work_t m_queue[QUEUE_SIZE];
+static size_t m_head;
+static size_t m_cnt;
+
+void coop_sched_run(void)
+{
+    while (m_cnt != 0)
+    {
+        work_t work = m_queue[m_head];
+
+        m_head = (m_head + 1) % QUEUE_SIZE;
+        m_cnt--;
+        if (work.handler(work.p_context))
+        {
+            m_queue[(m_head + m_cnt) % QUEUE_SIZE] = work;
+            m_cnt++;
+        }
+    }
+}
+
+ret_code_t coop_sched_defer(coop_sched_work_t handler, void * p_context)
+{
+    assert(handler != NULL);
+
+    if (m_cnt >= QUEUE_SIZE)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    m_queue[(m_head + m_cnt) % QUEUE_SIZE] = (work_t){ .handler = handler, .p_context = p_context };
+    m_cnt++;
+
+    return NRF_SUCCESS;
+}
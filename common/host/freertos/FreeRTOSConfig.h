@@ -0,0 +1,73 @@
+/** @file
+ * @brief Host shim: FreeRTOS configuration of blinky_freertos for the POSIX port.
+ *
+ * The scheduling parameters of blinky_freertos/config/FreeRTOSConfig.h: tick rate, priorities,
+ * preemption without time slicing, static allocation, timers. What the POSIX port needs differs:
+ * every task is a thread whose stack must hold PTHREAD_STACK_MIN, there is no tickless idle and
+ * no port optimised task selection. Run-time stats and the trace hooks, which read nRF
+ * peripherals, are off.
+ */
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#include "nrf.h"
+
+#define configUSE_PREEMPTION                        1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION     0
+#define configUSE_TICKLESS_IDLE                     0
+#define configCPU_CLOCK_HZ                          64000000
+#define configTICK_RATE_HZ                          1024
+#define configMAX_PRIORITIES                        ( 3 )
+#define configMINIMAL_STACK_SIZE                    ( 4096 )    /* Words, PTHREAD_STACK_MIN */
+#define configMAX_TASK_NAME_LEN                     ( 8 )
+#define configUSE_16_BIT_TICKS                      0
+#define configIDLE_SHOULD_YIELD                     1
+#define configUSE_MUTEXES                           1
+#define configUSE_RECURSIVE_MUTEXES                 1
+#define configUSE_COUNTING_SEMAPHORES               1
+#define configQUEUE_REGISTRY_SIZE                   2
+#define configUSE_QUEUE_SETS                        0
+#define configUSE_TIME_SLICING                      0
+#define configUSE_NEWLIB_REENTRANT                  0
+#define configENABLE_BACKWARD_COMPATIBILITY         1
+
+#define configSUPPORT_STATIC_ALLOCATION             1
+#define configSUPPORT_DYNAMIC_ALLOCATION            0
+
+#define configUSE_IDLE_HOOK                         0
+#define configUSE_TICK_HOOK                         0
+#define configCHECK_FOR_STACK_OVERFLOW              0
+#define configUSE_MALLOC_FAILED_HOOK                0
+
+#define configGENERATE_RUN_TIME_STATS               0
+#define configUSE_TRACE_FACILITY                    1
+#define configUSE_STATS_FORMATTING_FUNCTIONS        0
+
+#define configUSE_CO_ROUTINES                       0
+#define configMAX_CO_ROUTINE_PRIORITIES             ( 2 )
+
+#define configUSE_TIMERS                            1
+#define configTIMER_TASK_PRIORITY                   ( 2 )
+#define configTIMER_QUEUE_LENGTH                    32
+#define configTIMER_TASK_STACK_DEPTH                configMINIMAL_STACK_SIZE
+
+#define configASSERT( x )                           assert( x )
+
+#define INCLUDE_vTaskPrioritySet                    1
+#define INCLUDE_uxTaskPriorityGet                   1
+#define INCLUDE_vTaskDelete                         1
+#define INCLUDE_vTaskSuspend                        1
+#define INCLUDE_vTaskDelayUntil                     1
+#define INCLUDE_vTaskDelay                          1
+#define INCLUDE_xTaskGetSchedulerState              1
+#define INCLUDE_xTaskGetCurrentTaskHandle           1
+#define INCLUDE_uxTaskGetStackHighWaterMark         1
+#define INCLUDE_xTaskGetIdleTaskHandle              1
+#define INCLUDE_xTimerGetTimerDaemonTaskHandle      1
+#define INCLUDE_pcTaskGetTaskName                   1
+#define INCLUDE_eTaskGetState                       1
+#define INCLUDE_xTimerPendFunctionCall              1
+
+#endif /* FREERTOS_CONFIG_H */
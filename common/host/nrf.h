@@ -0,0 +1,41 @@
+/** @file
+ * @brief Host shim: CPU intrinsics used by the portable code.
+ */
+#ifndef NRF_H
+#define NRF_H
+
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __WFE()
+#define __SEV()
+
+#include <stdint.h>
+
+/* System control block, only the sleep mode written by blinky_freertos. Has no effect. */
+typedef struct
+{
+    uint32_t SCR;
+} SCB_Type;
+
+static SCB_Type nrf_host_scb __attribute__((unused));
+
+#define SCB                     (&nrf_host_scb)
+#define SCB_SCR_SLEEPDEEP_Msk   (1UL << 2)
+
+/* DWT cycle counter, read by the cli modules timing with CYCCNT. It does not count, intervals
+   measured on the host are 0. */
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+static DWT_Type nrf_host_dwt __attribute__((unused));
+
+#define DWT                     (&nrf_host_dwt)
+#define DWT_CTRL_CYCCNTENA_Msk  (1UL << 0)
+
+#define SystemCoreClock         64000000UL
+
+#endif // NRF_H
@@ -0,0 +1,11 @@
+/** @file
+ * @brief Host shim: ASSERT maps to assert().
+ */
+#ifndef NRF_ASSERT_H_
+#define NRF_ASSERT_H_
+
+#include <assert.h>
+
+#define ASSERT(expr) assert(expr)
+
+#endif // NRF_ASSERT_H_
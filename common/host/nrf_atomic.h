@@ -0,0 +1,26 @@
+/** @file
+ * @brief Host shim: 32-bit atomics on the GCC builtins.
+ */
+#ifndef NRF_ATOMIC_H__
+#define NRF_ATOMIC_H__
+
+#include <stdint.h>
+
+typedef volatile uint32_t nrf_atomic_u32_t;
+
+static inline uint32_t nrf_atomic_u32_store(nrf_atomic_u32_t * p_data, uint32_t value)
+{
+    return __atomic_exchange_n(p_data, value, __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t nrf_atomic_u32_add(nrf_atomic_u32_t * p_data, uint32_t value)
+{
+    return __atomic_add_fetch(p_data, value, __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t nrf_atomic_u32_sub(nrf_atomic_u32_t * p_data, uint32_t value)
+{
+    return __atomic_sub_fetch(p_data, value, __ATOMIC_SEQ_CST);
+}
+
+#endif // NRF_ATOMIC_H__
@@ -0,0 +1,203 @@
+#include "nrf_cli.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ARGC_MAX 12
+
+NRF_SECTION_DEF(cli_command, nrf_cli_cmd_entry_t const);
+
+#define CMD_CNT     NRF_SECTION_ITEM_COUNT(cli_command, nrf_cli_cmd_entry_t)
+#define CMD_GET(i)  NRF_SECTION_ITEM_GET(cli_command, nrf_cli_cmd_entry_t const, (i))
+
+nrf_cli_transport_t const nrf_cli_host_transport = { .p_api = NULL };
+
+void nrf_cli_fprintf(nrf_cli_t const *     p_cli,
+                     nrf_cli_vt100_color_t color,
+                     char const *          p_fmt,
+                     ...)
+{
+    va_list args;
+
+    /* Errors go to stdout too, to keep the order of the output. */
+    if (color == NRF_CLI_ERROR)
+    {
+        p_cli->p_ctx->errors++;
+    }
+
+    va_start(args, p_fmt);
+    vprintf(p_fmt, args);
+    va_end(args);
+}
+
+bool nrf_cli_help_requested(nrf_cli_t const * p_cli)
+{
+    return p_cli->p_ctx->show_help;
+}
+
+static bool entry_get(nrf_cli_cmd_entry_t const * p_set, size_t idx, nrf_cli_static_entry_t * p_entry)
+{
+    if (p_set->is_dynamic)
+    {
+        p_set->u.p_dynamic_get(idx, p_entry);
+    }
+    else
+    {
+        *p_entry = p_set->u.p_static[idx];
+    }
+    return p_entry->p_syntax != NULL;
+}
+
+void nrf_cli_help_print(nrf_cli_t const *               p_cli,
+                        nrf_cli_getopt_option_t const * p_opt,
+                        size_t                          opt_len)
+{
+    nrf_cli_static_entry_t const * p_cmd = &p_cli->p_ctx->active_cmd;
+    nrf_cli_static_entry_t         entry;
+
+    nrf_cli_print(p_cli, "%s - %s", p_cmd->p_syntax, p_cmd->p_help ? p_cmd->p_help : "");
+    for (size_t i = 0; i < opt_len; i++)
+    {
+        nrf_cli_print(p_cli, "  %s, %s: %s", p_opt[i].p_optname_short, p_opt[i].p_optname,
+                      p_opt[i].p_optname_help);
+    }
+    if (p_cmd->p_subcmd == NULL)
+    {
+        return;
+    }
+    nrf_cli_print(p_cli, "Subcommands:");
+    for (size_t i = 0; entry_get(p_cmd->p_subcmd, i, &entry); i++)
+    {
+        nrf_cli_print(p_cli, "  %-16s: %s", entry.p_syntax, entry.p_help ? entry.p_help : "");
+    }
+}
+
+static bool subcmd_find(nrf_cli_cmd_entry_t const * p_set,
+                        char const *                p_syntax,
+                        nrf_cli_static_entry_t *    p_entry)
+{
+    for (size_t i = 0; entry_get(p_set, i, p_entry); i++)
+    {
+        if (!strcmp(p_entry->p_syntax, p_syntax))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool nrf_cli_host_execute(nrf_cli_t const * p_cli, char * p_line)
+{
+    char * argv[ARGC_MAX + 1];
+    size_t argc = 0;
+
+    for (char * p_tok = strtok(p_line, " \t\r\n"); p_tok != NULL; p_tok = strtok(NULL, " \t\r\n"))
+    {
+        if (argc == ARGC_MAX)
+        {
+            return false;
+        }
+        argv[argc++] = p_tok;
+    }
+    if (argc == 0)
+    {
+        return true;
+    }
+    argv[argc] = NULL;
+
+    nrf_cli_static_entry_t entry = { .p_syntax = NULL };
+
+    for (size_t i = 0; i < CMD_CNT; i++)
+    {
+        if (!strcmp(CMD_GET(i)->u.p_static->p_syntax, argv[0]))
+        {
+            entry = *CMD_GET(i)->u.p_static;
+            break;
+        }
+    }
+    if (entry.p_syntax == NULL)
+    {
+        return false;
+    }
+
+    /* The deepest matching (sub)command with a handler gets the arguments following it. */
+    nrf_cli_static_entry_t active = entry;
+    size_t                 lvl    = 0;
+
+    for (size_t i = 1; (i < argc) && (entry.p_subcmd != NULL); i++)
+    {
+        if (!subcmd_find(entry.p_subcmd, argv[i], &entry))
+        {
+            break;
+        }
+        if (entry.handler != NULL)
+        {
+            active = entry;
+            lvl    = i;
+        }
+    }
+
+    p_cli->p_ctx->active_cmd = active;
+    p_cli->p_ctx->show_help  = false;
+    for (size_t i = lvl + 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+        {
+            p_cli->p_ctx->show_help = true;
+        }
+    }
+
+    if (active.handler == NULL)
+    {
+        return false;
+    }
+    active.handler(p_cli, argc - lvl, &argv[lvl]);
+    return true;
+}
+
+ret_code_t nrf_cli_init(nrf_cli_t const *  p_cli,
+                        void const *       p_transport_config,
+                        bool               use_colors,
+                        bool               log_backend,
+                        nrf_log_severity_t init_lvl)
+{
+    (void)use_colors;
+    (void)log_backend;
+    (void)init_lvl;
+
+    return p_cli->p_iface->p_api->init(p_cli->p_iface, p_transport_config, NULL, (void *)p_cli);
+}
+
+ret_code_t nrf_cli_start(nrf_cli_t const * p_cli)
+{
+    return p_cli->p_iface->p_api->enable(p_cli->p_iface, false);
+}
+
+void nrf_cli_process(nrf_cli_t const * p_cli)
+{
+    nrf_cli_ctx_t * p_ctx = p_cli->p_ctx;
+    char            c;
+    size_t          cnt;
+
+    while ((p_cli->p_iface->p_api->read(p_cli->p_iface, &c, sizeof(c), &cnt) == NRF_SUCCESS) &&
+           (cnt != 0))
+    {
+        if ((c != '\r') && (c != '\n'))
+        {
+            if (p_ctx->cmd_buff_len < sizeof(p_ctx->cmd_buff) - 1)
+            {
+                p_ctx->cmd_buff[p_ctx->cmd_buff_len++] = c;
+            }
+            continue;
+        }
+
+        p_ctx->cmd_buff[p_ctx->cmd_buff_len] = '\0';
+        p_ctx->cmd_buff_len = 0;
+        /* The line is tokenized in place, the command is its first token afterwards. */
+        if (!nrf_cli_host_execute(p_cli, p_ctx->cmd_buff))
+        {
+            nrf_cli_error(p_cli, "%s: command not found", p_ctx->cmd_buff);
+        }
+    }
+}
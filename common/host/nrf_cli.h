@@ -0,0 +1,247 @@
+/** @file
+ * @brief Host shim: the nrf_cli command API, printing to stdout.
+ *
+ * Commands are defined and registered with the same macros as on the target. Instead of the
+ * VT100 line editor, the host program passes complete lines to @ref nrf_cli_host_execute, which
+ * resolves the (sub)command the way nrf_cli does, or calls @ref nrf_cli_process to read the lines
+ * from the transport of the instance. Help output is shortened to the command help and the list
+ * of its subcommands.
+ */
+#ifndef NRF_CLI_H__
+#define NRF_CLI_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app_util.h"
+#include "nrf_log_types.h"
+#include "nrf_section.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct nrf_cli nrf_cli_t;
+
+typedef uint8_t nrf_cli_cmd_len_t;
+
+typedef void (*nrf_cli_cmd_handler)(nrf_cli_t const * p_cli, size_t argc, char ** argv);
+
+typedef struct nrf_cli_static_entry nrf_cli_static_entry_t;
+
+typedef void (*nrf_cli_dynamic_get)(size_t idx, nrf_cli_static_entry_t * p_static);
+
+typedef struct
+{
+    bool is_dynamic;
+    union
+    {
+        nrf_cli_dynamic_get            p_dynamic_get;
+        nrf_cli_static_entry_t const * p_static;
+    } u;
+} nrf_cli_cmd_entry_t;
+
+struct nrf_cli_static_entry
+{
+    char const *                p_syntax;
+    char const *                p_help;
+    nrf_cli_cmd_entry_t const * p_subcmd;
+    nrf_cli_cmd_handler         handler;
+};
+
+typedef struct
+{
+    char const * p_optname;
+    char const * p_optname_short;
+    char const * p_optname_help;
+} nrf_cli_getopt_option_t;
+
+typedef enum
+{
+    NRF_CLI_DEFAULT,
+    NRF_CLI_NORMAL,
+    NRF_CLI_INFO,
+    NRF_CLI_OPTION,
+    NRF_CLI_WARNING,
+    NRF_CLI_ERROR
+} nrf_cli_vt100_color_t;
+
+typedef enum
+{
+    NRF_CLI_TRANSPORT_EVT_RX_RDY,
+    NRF_CLI_TRANSPORT_EVT_TX_RDY
+} nrf_cli_transport_evt_t;
+
+typedef void (*nrf_cli_transport_handler_t)(nrf_cli_transport_evt_t evt_type, void * p_context);
+
+typedef struct nrf_cli_transport_s nrf_cli_transport_t;
+
+/**@brief Transport API, as on the target. */
+typedef struct
+{
+    ret_code_t (*init)(nrf_cli_transport_t const * p_transport,
+                       void const *                p_config,
+                       nrf_cli_transport_handler_t evt_handler,
+                       void *                      p_context);
+    ret_code_t (*uninit)(nrf_cli_transport_t const * p_transport);
+    ret_code_t (*enable)(nrf_cli_transport_t const * p_transport, bool blocking);
+    ret_code_t (*write)(nrf_cli_transport_t const * p_transport,
+                        void const *                p_data,
+                        size_t                      length,
+                        size_t *                    p_cnt);
+    ret_code_t (*read)(nrf_cli_transport_t const * p_transport,
+                       void *                      p_data,
+                       size_t                      length,
+                       size_t *                    p_cnt);
+} nrf_cli_transport_api_t;
+
+struct nrf_cli_transport_s
+{
+    nrf_cli_transport_api_t const * p_api;
+};
+
+/**@brief Transport of the instances fed by @ref nrf_cli_host_execute, it has no API. */
+extern nrf_cli_transport_t const nrf_cli_host_transport;
+
+#define NRF_CLI_HOST_CMD_BUFF_SIZE 128
+
+/**@brief Command execution context. */
+typedef struct
+{
+    nrf_cli_static_entry_t active_cmd;  //!< Command being executed, for the help.
+    bool                   show_help;   //!< -h or --help was given.
+    uint32_t               errors;      //!< Lines printed with nrf_cli_error().
+    char                   cmd_buff[NRF_CLI_HOST_CMD_BUFF_SIZE]; //!< Line read by nrf_cli_process().
+    size_t                 cmd_buff_len;                    //!< Bytes in cmd_buff.
+} nrf_cli_ctx_t;
+
+struct nrf_cli
+{
+    char const *                p_name;
+    nrf_cli_transport_t const * p_iface;
+    nrf_cli_ctx_t *             p_ctx;
+};
+
+/* The new line character and the log queue size are not used on the host. */
+#define NRF_CLI_DEF(name, cli_prefix, p_transport_iface, newline_ch, log_queue_size) \
+    static nrf_cli_ctx_t CONCAT_2(name, _ctx);                                 \
+    static nrf_cli_t const name =                                              \
+    {                                                                          \
+        .p_name  = cli_prefix,                                                 \
+        .p_iface = p_transport_iface,                                          \
+        .p_ctx   = &CONCAT_2(name, _ctx),                                      \
+    }
+
+#define NRF_CLI_CMD(_syntax, _p_subcmd, _p_help, _p_handler)                   \
+    {                                                                          \
+        .p_syntax = (char const *)STRINGIFY(_syntax),                          \
+        .p_help   = (char const *)_p_help,                                     \
+        .p_subcmd = _p_subcmd,                                                 \
+        .handler  = _p_handler                                                 \
+    }
+
+#define NRF_CLI_SUBCMD_SET_END { NULL, NULL, NULL, NULL }
+
+#define NRF_CLI_CREATE_STATIC_SUBCMD_SET(name)                                 \
+    static nrf_cli_static_entry_t const CONCAT_2(name, _raw)[];                \
+    static nrf_cli_cmd_entry_t const name =                                    \
+    {                                                                          \
+        .is_dynamic = false,                                                   \
+        .u          = { .p_static = CONCAT_2(name, _raw) }                     \
+    };                                                                         \
+    static nrf_cli_static_entry_t const CONCAT_2(name, _raw)[] =
+
+/* C++ has no forward declaration of a static array, the entries are the macro arguments. */
+#define NRF_CLI_CPP_CREATE_STATIC_SUBCMD_SET(name, ...)                        \
+    static nrf_cli_static_entry_t const CONCAT_2(name, _raw)[] =               \
+    {                                                                          \
+        __VA_ARGS__                                                            \
+    };                                                                         \
+    static nrf_cli_cmd_entry_t const name =                                    \
+    {                                                                          \
+        .is_dynamic = false,                                                   \
+        .u          = { .p_static = CONCAT_2(name, _raw) }                     \
+    }
+
+#define NRF_CLI_CREATE_DYNAMIC_CMD(name, get_function)                         \
+    static nrf_cli_cmd_entry_t const name =                                    \
+    {                                                                          \
+        .is_dynamic = true,                                                    \
+        .u          = { .p_dynamic_get = get_function }                        \
+    }
+
+#define NRF_CLI_CMD_REGISTER(syntax, p_subcmd, p_help, p_handler)              \
+    nrf_cli_static_entry_t const CONCAT_3(nrf_cli_, syntax, _raw) =            \
+        NRF_CLI_CMD(syntax, p_subcmd, p_help, p_handler);                      \
+    NRF_SECTION_ITEM_REGISTER(cli_command,                                     \
+                              nrf_cli_cmd_entry_t const CONCAT_3(nrf_cli_, syntax, _const)) = \
+    {                                                                          \
+        .is_dynamic = false,                                                   \
+        .u          = { .p_static = &CONCAT_3(nrf_cli_, syntax, _raw) }        \
+    }
+
+#define NRF_CLI_OPT(_p_optname, _p_shortname, _p_help)                         \
+    {                                                                          \
+        .p_optname       = _p_optname,                                         \
+        .p_optname_short = _p_shortname,                                       \
+        .p_optname_help  = _p_help,                                            \
+    }
+
+void nrf_cli_fprintf(nrf_cli_t const *     p_cli,
+                     nrf_cli_vt100_color_t color,
+                     char const *          p_fmt,
+                     ...) __attribute__((format(printf, 3, 4)));
+
+#define nrf_cli_info(_p_cli, _ft, ...)  nrf_cli_fprintf(_p_cli, NRF_CLI_INFO, _ft "\n", ##__VA_ARGS__)
+#define nrf_cli_print(_p_cli, _ft, ...) nrf_cli_fprintf(_p_cli, NRF_CLI_DEFAULT, _ft "\n", ##__VA_ARGS__)
+#define nrf_cli_warn(_p_cli, _ft, ...)  nrf_cli_fprintf(_p_cli, NRF_CLI_WARNING, _ft "\n", ##__VA_ARGS__)
+#define nrf_cli_error(_p_cli, _ft, ...) nrf_cli_fprintf(_p_cli, NRF_CLI_ERROR, _ft "\n", ##__VA_ARGS__)
+
+bool nrf_cli_help_requested(nrf_cli_t const * p_cli);
+
+void nrf_cli_help_print(nrf_cli_t const *               p_cli,
+                        nrf_cli_getopt_option_t const * p_opt,
+                        size_t                          opt_len);
+
+/**@brief Function for initializing the transport of an instance read by @ref nrf_cli_process.
+ *
+ * The colors, the log backend and its level are not used on the host. The instances fed by
+ * @ref nrf_cli_host_execute need neither this nor @ref nrf_cli_start.
+ */
+ret_code_t nrf_cli_init(nrf_cli_t const *  p_cli,
+                        void const *       p_transport_config,
+                        bool               use_colors,
+                        bool               log_backend,
+                        nrf_log_severity_t init_lvl);
+
+/**@brief Function for enabling the transport of an instance, in non-blocking mode. */
+ret_code_t nrf_cli_start(nrf_cli_t const * p_cli);
+
+/**@brief Function for executing a command line.
+ *
+ * @param[in]     p_cli  CLI instance.
+ * @param[in,out] p_line Command line, tokenized in place on spaces and tabs.
+ *
+ * @retval true  Line empty or command executed.
+ * @retval false Unknown command or too many arguments.
+ */
+bool nrf_cli_host_execute(nrf_cli_t const * p_cli, char * p_line);
+
+/**@brief Function for executing the complete lines available from the transport.
+ *
+ * Reads the transport one byte at a time, as nrf_cli does, so a command switching the transport
+ * to another mode (e.g. batch begin) sees all the bytes following its line.
+ * An unknown command is reported with nrf_cli_error(), a line longer than NRF_CLI_HOST_CMD_BUFF_SIZE
+ * is truncated.
+ *
+ * @param[in] p_cli CLI instance.
+ */
+void nrf_cli_process(nrf_cli_t const * p_cli);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_CLI_H__
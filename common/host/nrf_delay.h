@@ -0,0 +1,15 @@
+/** @file
+ * @brief Host shim: busy waits sleep instead.
+ */
+#ifndef NRF_DELAY_H__
+#define NRF_DELAY_H__
+
+#include <stdint.h>
+#include <unistd.h>
+
+static inline void nrf_delay_ms(uint32_t ms_time)
+{
+    (void)usleep(ms_time * 1000);
+}
+
+#endif // NRF_DELAY_H__
@@ -0,0 +1,14 @@
+/** @file
+ * @brief Host shim: the clock driver has nothing to start.
+ */
+#ifndef NRF_DRV_CLOCK_H__
+#define NRF_DRV_CLOCK_H__
+
+#include "sdk_errors.h"
+
+static inline ret_code_t nrf_drv_clock_init(void)
+{
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_DRV_CLOCK_H__
@@ -0,0 +1,78 @@
+#include "nrf_gpio.h"
+
+#include <assert.h>
+
+typedef struct
+{
+    bool     output;
+    bool     out;
+    bool     in;
+    uint32_t changes;
+} pin_t;
+
+static pin_t m_pins[NRF_GPIO_HOST_PINS];
+
+static pin_t * pin_get(uint32_t pin_number)
+{
+    assert(pin_number < NRF_GPIO_HOST_PINS);
+    return &m_pins[pin_number];
+}
+
+void nrf_gpio_cfg_output(uint32_t pin_number)
+{
+    pin_get(pin_number)->output = true;
+}
+
+void nrf_gpio_cfg_input(uint32_t pin_number, int pull_config)
+{
+    (void)pull_config;
+    pin_get(pin_number)->output = false;
+}
+
+void nrf_gpio_pin_write(uint32_t pin_number, uint32_t value)
+{
+    pin_t * p_pin = pin_get(pin_number);
+
+    if (p_pin->out != (value != 0))
+    {
+        p_pin->out = (value != 0);
+        p_pin->changes++;
+    }
+}
+
+void nrf_gpio_pin_set(uint32_t pin_number)
+{
+    nrf_gpio_pin_write(pin_number, 1);
+}
+
+void nrf_gpio_pin_clear(uint32_t pin_number)
+{
+    nrf_gpio_pin_write(pin_number, 0);
+}
+
+void nrf_gpio_pin_toggle(uint32_t pin_number)
+{
+    nrf_gpio_pin_write(pin_number, !pin_get(pin_number)->out);
+}
+
+uint32_t nrf_gpio_pin_read(uint32_t pin_number)
+{
+    pin_t const * p_pin = pin_get(pin_number);
+
+    return p_pin->output ? p_pin->out : p_pin->in;
+}
+
+uint32_t nrf_gpio_pin_out_read(uint32_t pin_number)
+{
+    return pin_get(pin_number)->out;
+}
+
+uint32_t nrf_gpio_host_changes_get(uint32_t pin_number)
+{
+    return pin_get(pin_number)->changes;
+}
+
+void nrf_gpio_host_input_set(uint32_t pin_number, bool value)
+{
+    pin_get(pin_number)->in = value;
+}
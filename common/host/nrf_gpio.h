@@ -0,0 +1,39 @@
+/** @file
+ * @brief Host shim: GPIO outputs kept in memory.
+ *
+ * Every pin remembers its output level and counts its toggles, so a host program can check or
+ * print what the LEDs of the app did.
+ */
+#ifndef NRF_GPIO_H__
+#define NRF_GPIO_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_GPIO_PIN_MAP(port, pin) (((port) << 5) | ((pin) & 0x1F))
+#define NRF_GPIO_HOST_PINS          48
+
+void nrf_gpio_cfg_output(uint32_t pin_number);
+void nrf_gpio_cfg_input(uint32_t pin_number, int pull_config);
+void nrf_gpio_pin_write(uint32_t pin_number, uint32_t value);
+void nrf_gpio_pin_set(uint32_t pin_number);
+void nrf_gpio_pin_clear(uint32_t pin_number);
+void nrf_gpio_pin_toggle(uint32_t pin_number);
+uint32_t nrf_gpio_pin_read(uint32_t pin_number);
+uint32_t nrf_gpio_pin_out_read(uint32_t pin_number);
+
+/**@brief Function for reading how many times the output level of a pin changed. */
+uint32_t nrf_gpio_host_changes_get(uint32_t pin_number);
+
+/**@brief Function for forcing the input level of a pin, as read by nrf_gpio_pin_read(). */
+void nrf_gpio_host_input_set(uint32_t pin_number, bool value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_GPIO_H__
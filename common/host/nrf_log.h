@@ -0,0 +1,15 @@
+/** @file
+ * @brief Host shim: logging is compiled out.
+ */
+#ifndef NRF_LOG_H_
+#define NRF_LOG_H_
+
+#define NRF_LOG_ERROR(...)              do { } while (0)
+#define NRF_LOG_WARNING(...)            do { } while (0)
+#define NRF_LOG_INFO(...)               do { } while (0)
+#define NRF_LOG_DEBUG(...)              do { } while (0)
+#define NRF_LOG_RAW_INFO(...)           do { } while (0)
+#define NRF_LOG_HEXDUMP_INFO(p, len)    do { } while (0)
+#define NRF_LOG_FLUSH()                 do { } while (0)
+
+#endif // NRF_LOG_H_
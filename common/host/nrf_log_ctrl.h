@@ -0,0 +1,12 @@
+/** @file
+ * @brief Host shim: logging is compiled out, see nrf_log.h.
+ */
+#ifndef NRF_LOG_CTRL_H
+#define NRF_LOG_CTRL_H
+
+#include "sdk_errors.h"
+
+#define NRF_LOG_INIT(...)               NRF_SUCCESS
+#define NRF_LOG_PROCESS()               false
+
+#endif // NRF_LOG_CTRL_H
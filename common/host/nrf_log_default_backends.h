@@ -0,0 +1,9 @@
+/** @file
+ * @brief Host shim: logging is compiled out, see nrf_log.h.
+ */
+#ifndef NRF_LOG_DEFAULT_BACKENDS_H__
+#define NRF_LOG_DEFAULT_BACKENDS_H__
+
+#define NRF_LOG_DEFAULT_BACKENDS_INIT() do { } while (0)
+
+#endif // NRF_LOG_DEFAULT_BACKENDS_H__
@@ -0,0 +1,17 @@
+/** @file
+ * @brief Host shim: the logger severity levels, as taken by nrf_cli_init().
+ */
+#ifndef NRF_LOG_TYPES_H
+#define NRF_LOG_TYPES_H
+
+typedef enum
+{
+    NRF_LOG_SEVERITY_NONE,
+    NRF_LOG_SEVERITY_ERROR,
+    NRF_LOG_SEVERITY_WARNING,
+    NRF_LOG_SEVERITY_INFO,
+    NRF_LOG_SEVERITY_DEBUG,
+    NRF_LOG_SEVERITY_INFO_RAW,
+} nrf_log_severity_t;
+
+#endif // NRF_LOG_TYPES_H
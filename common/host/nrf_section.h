@@ -0,0 +1,32 @@
+/** @file
+ * @brief Host shim: section variables without a linker script.
+ *
+ * The target puts each item in a `.<name>` input section that the linker script collects between
+ * `__start_<name>` and `__stop_<name>`. On the host the section is called `<name>`: GNU ld
+ * defines both symbols itself for sections whose name is a valid C identifier.
+ */
+#ifndef NRF_SECTION_H__
+#define NRF_SECTION_H__
+
+#include "app_util.h"
+
+#define NRF_SECTION_START_ADDR(section_name)    &CONCAT_2(__start_, section_name)
+#define NRF_SECTION_END_ADDR(section_name)      &CONCAT_2(__stop_, section_name)
+#define NRF_SECTION_LENGTH(section_name)                                    \
+    ((size_t)NRF_SECTION_END_ADDR(section_name) -                           \
+     (size_t)NRF_SECTION_START_ADDR(section_name))
+
+#define NRF_SECTION_DEF(section_name, data_type)                            \
+    extern data_type CONCAT_2(__start_, section_name);                      \
+    extern void *    CONCAT_2(__stop_, section_name)
+
+#define NRF_SECTION_ITEM_REGISTER(section_name, section_var)                \
+    section_var __attribute__((section(STRINGIFY(section_name)))) __attribute__((used))
+
+#define NRF_SECTION_ITEM_GET(section_name, data_type, i)                    \
+    ((data_type *)NRF_SECTION_START_ADDR(section_name) + (i))
+
+#define NRF_SECTION_ITEM_COUNT(section_name, data_type)                     \
+    NRF_SECTION_LENGTH(section_name) / sizeof(data_type)
+
+#endif // NRF_SECTION_H__
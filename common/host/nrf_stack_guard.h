@@ -0,0 +1,9 @@
+/** @file
+ * @brief Host shim: nominal stack size, the host has no stack guard.
+ */
+#ifndef NRF_STACK_GUARD_H__
+#define NRF_STACK_GUARD_H__
+
+#define STACK_SIZE 8192
+
+#endif // NRF_STACK_GUARD_H__
@@ -0,0 +1,18 @@
+/** @file
+ * @brief Host shim: LEDs of the nRF52840 dongle, as in the SDK board file.
+ */
+#ifndef PCA10059_H
+#define PCA10059_H
+
+#include "nrf_gpio.h"
+
+#define LEDS_NUMBER    4
+
+#define LED1_G         NRF_GPIO_PIN_MAP(0,6)
+#define LED2_R         NRF_GPIO_PIN_MAP(0,8)
+#define LED2_G         NRF_GPIO_PIN_MAP(1,9)
+#define LED2_B         NRF_GPIO_PIN_MAP(0,12)
+
+#define LEDS_LIST { LED1_G, LED2_R, LED2_G, LED2_B }
+
+#endif // PCA10059_H
@@ -0,0 +1,73 @@
+/** @file
+ * @brief Host shim: periodic_work of blinky_freertos on FreeRTOS software timers.
+ *
+ * There is no RTC2 on the host. Every periodic work is an auto-reload timer whose callback, in
+ * the timer service task, sets the notification bits of the task: same API and periods, rounded
+ * to ticks, with the extra context switch through the service task.
+ */
+#include "periodic_work.h"
+
+#include <assert.h>
+
+#include "timers.h"
+
+typedef struct
+{
+    TaskHandle_t  task;
+    uint32_t      bits;
+    uint32_t      last_tick;
+    TimerHandle_t timer;
+    StaticTimer_t timer_buf;
+} work_t;
+
+static work_t m_works[PERIODIC_WORK_COUNT];
+
+static void timer_handler(TimerHandle_t timer)
+{
+    work_t * p_work = &m_works[(uintptr_t)pvTimerGetTimerID(timer)];
+
+    p_work->last_tick = xTaskGetTickCount();
+    (void)xTaskNotify(p_work->task, p_work->bits, eSetBits);
+}
+
+void periodic_work_init(void)
+{
+    for (uintptr_t idx = 0; idx < PERIODIC_WORK_COUNT; idx++)
+    {
+        m_works[idx].timer = xTimerCreateStatic("PWRK", 1, pdTRUE, (void *)idx, timer_handler,
+                                                &m_works[idx].timer_buf);
+    }
+}
+
+void periodic_work_start(uint32_t idx, TaskHandle_t task, uint32_t bits, uint32_t period_ms)
+{
+    assert(idx < PERIODIC_WORK_COUNT);
+
+    m_works[idx].task = task;
+    m_works[idx].bits = bits;
+    /* Also starts the timer. Before the scheduler starts, the command waits in the queue. */
+    (void)xTimerChangePeriod(m_works[idx].timer, pdMS_TO_TICKS(period_ms), 0);
+}
+
+void periodic_work_stop(uint32_t idx)
+{
+    assert(idx < PERIODIC_WORK_COUNT);
+
+    (void)xTimerStop(m_works[idx].timer, 0);
+}
+
+/* No cycle counter, the tick count at the last expiry. */
+uint32_t periodic_work_last_cyc(uint32_t idx)
+{
+    assert(idx < PERIODIC_WORK_COUNT);
+
+    return m_works[idx].last_tick;
+}
+
+/* The timer service task never skips an expiry. */
+uint32_t periodic_work_missed(uint32_t idx)
+{
+    (void)idx;
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+/** @file
+ * @brief Host shim: common SDK includes. sdk_config.h is the one of the app being built.
+ *
+ * stdio.h and stdlib.h come with the SDK headers on the target, the app sources rely on them.
+ */
+#ifndef SDK_COMMON_H__
+#define SDK_COMMON_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sdk_config.h"
+#include "sdk_errors.h"
+#include "app_util.h"
+#include "nrf_assert.h"
+
+#define NRF_MODULE_ENABLED(module) \
+    ((defined(module ## _ENABLED) && (module ## _ENABLED)) ? 1 : 0)
+
+#endif // SDK_COMMON_H__
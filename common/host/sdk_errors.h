@@ -0,0 +1,21 @@
+/** @file
+ * @brief Host shim: SDK error codes.
+ */
+#ifndef SDK_ERRORS_H__
+#define SDK_ERRORS_H__
+
+#include <stdint.h>
+
+typedef uint32_t ret_code_t;
+
+#define NRF_SUCCESS             0
+#define NRF_ERROR_INTERNAL      3
+#define NRF_ERROR_NO_MEM        4
+#define NRF_ERROR_NOT_FOUND     5
+#define NRF_ERROR_INVALID_PARAM 7
+#define NRF_ERROR_INVALID_STATE 8
+#define NRF_ERROR_INVALID_LENGTH 9
+#define NRF_ERROR_BUSY          17
+#define NRF_ERROR_IO_PENDING    0x8004
+
+#endif // SDK_ERRORS_H__
@@ -0,0 +1,173 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(TRACED_MUTEX)
+#include "traced_mutex.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "task.h"
+#include "nrf.h"
+#include "bench_dwt.h"
+
+#define LINE_SIZE   128
+
+/* Waits of a task, over all the mutexes. */
+typedef struct
+{
+    TaskHandle_t task;
+    uint32_t     takes;
+    uint32_t     contended;
+    uint32_t     wait_max;
+    uint64_t     wait_total;
+} task_waits_t;
+
+volatile uint32_t bench_traced_mutex_wait_max_cycles __attribute__((used));
+
+static traced_mutex_t * m_p_first;
+static task_waits_t     m_tasks[TRACED_MUTEX_MAX_TASKS];
+
+/* Entry of the current task, NULL when the table is full. In a critical section. */
+static task_waits_t * task_waits_get(void)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+
+    for (size_t i = 0; i < ARRAY_SIZE(m_tasks); i++)
+    {
+        if (m_tasks[i].task == task)
+        {
+            return &m_tasks[i];
+        }
+        if (m_tasks[i].task == NULL)
+        {
+            m_tasks[i].task = task;
+            return &m_tasks[i];
+        }
+    }
+    return NULL;
+}
+
+static uint32_t us(uint64_t cycles)
+{
+    return (uint32_t)((cycles * 1000000) / SystemCoreClock);
+}
+
+void traced_mutex_init(traced_mutex_t * p_mutex, char const * p_name)
+{
+    bench_dwt_enable();
+
+    memset(p_mutex, 0, sizeof(*p_mutex));
+    p_mutex->handle = xSemaphoreCreateMutexStatic(&p_mutex->buf);
+    p_mutex->p_name = p_name;
+    p_mutex->p_next = m_p_first;
+    m_p_first       = p_mutex;
+}
+
+BaseType_t traced_mutex_take(traced_mutex_t * p_mutex, TickType_t wait)
+{
+    uint32_t   start  = DWT->CYCCNT;
+    BaseType_t result = xSemaphoreTake(p_mutex->handle, 0);
+    bool       waited = false;
+
+    if ((result != pdPASS) && (wait != 0))
+    {
+        result = xSemaphoreTake(p_mutex->handle, wait);
+        waited = true;
+    }
+
+    uint32_t now  = DWT->CYCCNT;
+    uint32_t time = waited ? (now - start) : 0;
+
+    taskENTER_CRITICAL();
+    task_waits_t * p_task = task_waits_get();
+
+    if (p_task != NULL)
+    {
+        p_task->takes++;
+    }
+    if (waited)
+    {
+        p_mutex->contended++;
+        p_mutex->wait_total += time;
+        p_mutex->wait_max    = MAX(p_mutex->wait_max, time);
+        if (p_task != NULL)
+        {
+            p_task->contended++;
+            p_task->wait_total += time;
+            p_task->wait_max    = MAX(p_task->wait_max, time);
+        }
+        bench_traced_mutex_wait_max_cycles = MAX(bench_traced_mutex_wait_max_cycles, time);
+    }
+    if (result == pdPASS)
+    {
+        p_mutex->takes++;
+        p_mutex->taken_at = now;
+        p_mutex->priority = uxTaskPriorityGet(NULL);
+    }
+    else
+    {
+        p_mutex->timeouts++;
+    }
+    taskEXIT_CRITICAL();
+
+    return result;
+}
+
+void traced_mutex_give(traced_mutex_t * p_mutex)
+{
+    uint32_t hold = DWT->CYCCNT - p_mutex->taken_at;
+
+    taskENTER_CRITICAL();
+    p_mutex->hold_max = MAX(p_mutex->hold_max, hold);
+    /* Raised by a waiter above the holder, dropped again by the give. */
+    if (uxTaskPriorityGet(NULL) > p_mutex->priority)
+    {
+        p_mutex->inherited++;
+    }
+    taskEXIT_CRITICAL();
+
+    (void)xSemaphoreGive(p_mutex->handle);
+}
+
+void traced_mutex_report(traced_mutex_print_t print, void * p_ctx)
+{
+    char line[LINE_SIZE];
+
+    for (traced_mutex_t * p_mutex = m_p_first; p_mutex != NULL; p_mutex = p_mutex->p_next)
+    {
+        traced_mutex_t copy;
+
+        taskENTER_CRITICAL();
+        copy = *p_mutex;
+        taskEXIT_CRITICAL();
+
+        (void)snprintf(line, sizeof(line),
+                       "lock name=%s takes=%u contended=%u timeouts=%u inherited=%u "
+                       "wait_max=%u wait_total=%u hold_max=%u",
+                       copy.p_name, (unsigned)copy.takes, (unsigned)copy.contended,
+                       (unsigned)copy.timeouts, (unsigned)copy.inherited,
+                       (unsigned)us(copy.wait_max), (unsigned)us(copy.wait_total),
+                       (unsigned)us(copy.hold_max));
+        print(p_ctx, line);
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(m_tasks); i++)
+    {
+        task_waits_t copy;
+
+        taskENTER_CRITICAL();
+        copy = m_tasks[i];
+        taskEXIT_CRITICAL();
+
+        if (copy.task == NULL)
+        {
+            break;
+        }
+        (void)snprintf(line, sizeof(line),
+                       "lock task=%s takes=%u contended=%u wait_max=%u wait_total=%u",
+                       pcTaskGetName(copy.task), (unsigned)copy.takes, (unsigned)copy.contended,
+                       (unsigned)us(copy.wait_max), (unsigned)us(copy.wait_total));
+        print(p_ctx, line);
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(TRACED_MUTEX)
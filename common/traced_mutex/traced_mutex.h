@@ -0,0 +1,116 @@
+/** @file
+ * @defgroup traced_mutex Traced mutex
+ * @{
+ *
+ * @brief FreeRTOS mutex with priority inheritance, tracing the time tasks wait for it.
+ *
+ * A FreeRTOS mutex, not a binary semaphore: while a task of higher priority waits, the holder
+ * inherits its priority, so that tasks of the priorities in between cannot keep the holder, and
+ * with it the waiting task, off the CPU. With configMAX_PRIORITIES at 3 every task shares its
+ * priority with another one, the inheritance only matters when the waiter is above the holder,
+ * but the waits are traced either way:
+ *
+ * @code
+ * TRACED_MUTEX_DEF(m_usbd_mutex);
+ *
+ * traced_mutex_init(&m_usbd_mutex, "usbd");
+ *
+ * traced_mutex_take(&m_usbd_mutex, portMAX_DELAY);
+ * ...
+ * traced_mutex_give(&m_usbd_mutex);
+ * @endcode
+ *
+ * Every take first tries the mutex without waiting. A take that succeeds at once is only counted,
+ * a take that has to wait is contended and its wait measured with CYCCNT. Per mutex, the hold time
+ * and whether the holder inherited a higher priority while holding it are recorded as well. The
+ * waits are also summed per task, over all the mutexes, for the @ref TRACED_MUTEX_MAX_TASKS
+ * first tasks taking one. @ref traced_mutex_report prints one line per mutex and per task, times
+ * in microseconds:
+ *
+ *     lock name=usbd takes=812 contended=9 timeouts=0 inherited=9 wait_max=412 wait_total=1735 hold_max=398
+ *     lock task=CONS takes=405 contended=3 wait_max=67 wait_total=121
+ *     lock task=USBD takes=407 contended=6 wait_max=412 wait_total=1614
+ *
+ * The longest wait is also bench_traced_mutex_wait_max_cycles, read by
+ * apps/build/profile_bench.py --run.
+ *
+ * CYCCNT stops while the CPU sleeps: a wait during which the holder blocks and the system goes
+ * to sleep is reported shorter than it was. Mutexes cannot be taken from interrupts.
+ */
+#ifndef TRACED_MUTEX_H__
+#define TRACED_MUTEX_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for printing a line of the report, without the line ending. */
+typedef void (*traced_mutex_print_t)(void * p_ctx, char const * p_line);
+
+/**@brief Traced mutex. Define it with @ref TRACED_MUTEX_DEF. */
+typedef struct traced_mutex_s
+{
+    SemaphoreHandle_t       handle;
+    StaticSemaphore_t       buf;
+    char const *            p_name;
+    struct traced_mutex_s * p_next;         //!< Next mutex reported.
+    uint32_t                taken_at;       //!< CYCCNT when the holder took it.
+    UBaseType_t             priority;       //!< Priority of the holder when it took it.
+    uint32_t                takes;
+    uint32_t                contended;      //!< Takes that had to wait.
+    uint32_t                timeouts;       //!< Takes that gave up.
+    uint32_t                inherited;      //!< Holders that inherited a higher priority.
+    uint32_t                wait_max;       //!< In CPU cycles.
+    uint64_t                wait_total;     //!< In CPU cycles.
+    uint32_t                hold_max;       //!< In CPU cycles.
+} traced_mutex_t;
+
+/**@brief Macro for defining a traced mutex.
+ *
+ * @param _name Name of the instance.
+ */
+#define TRACED_MUTEX_DEF(_name) static traced_mutex_t _name
+
+extern volatile uint32_t bench_traced_mutex_wait_max_cycles;    //!< Longest wait, all mutexes.
+
+/**@brief Function for creating a mutex and adding it to the report.
+ *
+ * Starts the cycle counter. Call it before the scheduler starts or from a single task.
+ *
+ * @param[out] p_mutex Mutex.
+ * @param[in]  p_name  Name printed in the report, kept by reference.
+ */
+void traced_mutex_init(traced_mutex_t * p_mutex, char const * p_name);
+
+/**@brief Function for taking a mutex.
+ *
+ * @param[in] p_mutex Mutex.
+ * @param[in] wait    Ticks to wait at most, portMAX_DELAY to wait forever.
+ *
+ * @retval pdPASS Mutex taken.
+ * @retval pdFAIL Timed out.
+ */
+BaseType_t traced_mutex_take(traced_mutex_t * p_mutex, TickType_t wait);
+
+/**@brief Function for giving back a mutex, by the task holding it. */
+void traced_mutex_give(traced_mutex_t * p_mutex);
+
+/**@brief Function for printing the statistics of every mutex and every task since boot.
+ *
+ * @param[in] print Output function.
+ * @param[in] p_ctx Passed to @p print.
+ */
+void traced_mutex_report(traced_mutex_print_t print, void * p_ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACED_MUTEX_H__
+
+/** @} */
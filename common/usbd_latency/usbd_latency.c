@@ -0,0 +1,75 @@
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(USBD_LATENCY)
+#include "usbd_latency.h"
+
+#include "nrf.h"
+#include "app_util_platform.h"
+#include "bench_dwt.h"
+
+STATIC_ASSERT(APP_USBD_CONFIG_EVENT_QUEUE_ENABLE);
+
+/* One more than the queue, so that a full ring is not empty. */
+#define RING_SIZE   (APP_USBD_CONFIG_EVENT_QUEUE_SIZE + 1)
+
+volatile uint32_t bench_usbd_latency_max_cycles __attribute__((used));
+volatile uint32_t bench_usbd_latency_mean_cycles __attribute__((used));
+volatile uint32_t bench_usbd_latency_events __attribute__((used));
+
+/* Queue times, written in the interrupt at m_head, read in thread mode at m_tail. */
+static uint32_t          m_ring[RING_SIZE];
+static volatile uint32_t m_head;
+static volatile uint32_t m_tail;
+static uint64_t          m_sum;
+
+void usbd_latency_init(void)
+{
+    bench_dwt_enable();
+
+    m_head = m_tail = 0;
+    m_sum  = 0;
+    bench_usbd_latency_max_cycles  = 0;
+    bench_usbd_latency_mean_cycles = 0;
+    bench_usbd_latency_events      = 0;
+}
+
+void usbd_latency_isr_handler(app_usbd_internal_evt_t const * const p_event, bool queued)
+{
+    UNUSED_PARAMETER(p_event);
+
+    uint32_t next = (m_head + 1) % RING_SIZE;
+
+    if (!queued || (next == m_tail))
+    {
+        return;
+    }
+    m_ring[m_head] = DWT->CYCCNT;
+    m_head         = next;
+}
+
+void usbd_latency_ev_handler(app_usbd_internal_evt_t const * const p_event)
+{
+    uint32_t tail = m_tail;
+
+    if (tail != m_head)
+    {
+        uint32_t wait = DWT->CYCCNT - m_ring[tail];
+
+        m_tail = (tail + 1) % RING_SIZE;
+        m_sum += wait;
+        bench_usbd_latency_events++;
+        bench_usbd_latency_max_cycles  = MAX(bench_usbd_latency_max_cycles, wait);
+        bench_usbd_latency_mean_cycles = (uint32_t)(m_sum / bench_usbd_latency_events);
+    }
+
+    app_usbd_event_execute(p_event);
+}
+
+void usbd_latency_queue_empty(void)
+{
+    /* An event queued since the queue was found empty loses its timestamp, not more. */
+    CRITICAL_REGION_ENTER();
+    m_tail = m_head;
+    CRITICAL_REGION_EXIT();
+}
+
+#endif // NRF_MODULE_ENABLED(USBD_LATENCY)
@@ -0,0 +1,66 @@
+/** @file
+ * @defgroup usbd_latency USB event latency
+ * @{
+ *
+ * @brief Time USB events wait in the app_usbd event queue before they are processed.
+ *
+ * With APP_USBD_CONFIG_EVENT_QUEUE_ENABLE the USBD interrupt only queues the events, they are
+ * processed by app_usbd_event_queue_process() in the main loop or in a task. An event waits
+ * there as long as the code running before the next call, in a super-loop every other piece of
+ * work of the loop. The module timestamps every event queued with CYCCNT, in the interrupt, and
+ * measures the wait when the event is executed:
+ *
+ * @code
+ * static const app_usbd_config_t usbd_config = {
+ *     .ev_isr_handler = usbd_latency_isr_handler,
+ *     .ev_handler     = usbd_latency_ev_handler,
+ *     .ev_state_proc  = usbd_user_ev_handler
+ * };
+ *
+ * while (app_usbd_event_queue_process()) { }
+ * usbd_latency_queue_empty();
+ * @endcode
+ *
+ * The results are the bench_usbd_latency_ variables, read from RAM by
+ * apps/build/profile_bench.py --run like the other boot measurements, so that the bare-metal and
+ * the FreeRTOS builds of an app can be compared. The maximum covers everything since boot:
+ * enumeration and the traffic that followed.
+ */
+#ifndef USBD_LATENCY_H__
+#define USBD_LATENCY_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "app_usbd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern volatile uint32_t bench_usbd_latency_max_cycles;     //!< Longest wait in CPU cycles.
+extern volatile uint32_t bench_usbd_latency_mean_cycles;    //!< Mean wait in CPU cycles.
+extern volatile uint32_t bench_usbd_latency_events;         //!< Events measured.
+
+/**@brief Function for starting the cycle counter and clearing the results. */
+void usbd_latency_init(void);
+
+/**@brief ev_isr_handler of app_usbd_config_t, called in the interrupt queuing an event. */
+void usbd_latency_isr_handler(app_usbd_internal_evt_t const * const p_event, bool queued);
+
+/**@brief ev_handler of app_usbd_config_t, measures the wait and executes the event. */
+void usbd_latency_ev_handler(app_usbd_internal_evt_t const * const p_event);
+
+/**@brief Function for resynchronizing the timestamps with the queue, once it is empty.
+ *
+ * Events queued without the ISR handler being called would otherwise shift the timestamps.
+ */
+void usbd_latency_queue_empty(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // USBD_LATENCY_H__
+
+/** @} */
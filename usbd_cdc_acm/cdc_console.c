@@ -0,0 +1,69 @@
+/**@file
+ * @ingroup cdc_console
+ */
+
+#include <stdio.h>
+
+#include "nrf_gpio.h"
+#include "pca10059.h"
+#include "cdc_console.h"
+
+#define CONSOLE_NAME "\r\n\033[0;32musbd_cdc_acm:~$\033[0m "
+
+#define READ_SIZE 1
+
+static char g_rx_buffer[READ_SIZE];
+static char g_tx_buffer[NRFX_USBD_EPSIZE];
+
+static void print_console_name(app_usbd_cdc_acm_t const * p_cdc_acm)
+{
+    size_t size = sprintf(g_tx_buffer, CONSOLE_NAME);
+    app_usbd_cdc_acm_write(p_cdc_acm, g_tx_buffer, size);
+}
+
+void cdc_console_event_handle(app_usbd_cdc_acm_t const * p_cdc_acm,
+                              app_usbd_cdc_acm_user_event_t event)
+{
+    switch (event)
+    {
+        case APP_USBD_CDC_ACM_USER_EVT_PORT_OPEN:
+        {
+            nrf_gpio_pin_clear(LED_CDC_ACM_OPEN); // Turn ON
+
+            /*Setup first transfer*/
+            app_usbd_cdc_acm_read(p_cdc_acm, g_rx_buffer, READ_SIZE);
+            size_t size = sprintf(g_tx_buffer, "USB Connected!\r\n\033[0;32musbd_cdc_acm:~$\033[0m ");
+            app_usbd_cdc_acm_write(p_cdc_acm, g_tx_buffer, size);
+            break;
+        }
+        case APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE:
+            nrf_gpio_pin_set(LED_CDC_ACM_OPEN); // Turn OFF
+            break;
+        case APP_USBD_CDC_ACM_USER_EVT_TX_DONE:
+            nrf_gpio_pin_toggle(LED_CDC_ACM_TX);
+            break;
+        case APP_USBD_CDC_ACM_USER_EVT_RX_DONE:
+        {
+            nrf_gpio_pin_toggle(LED_CDC_ACM_RX);
+            ret_code_t ret = NRF_SUCCESS;
+            do
+            {
+                /* Fetch data until internal buffer is empty */
+                ret = app_usbd_cdc_acm_read(p_cdc_acm, g_rx_buffer, READ_SIZE);
+                if(g_rx_buffer[0] == 0x0d) // New line received
+                {
+                    print_console_name(p_cdc_acm);
+                }
+                else
+                {
+                    app_usbd_cdc_acm_write(p_cdc_acm, g_rx_buffer, READ_SIZE);
+                }
+                
+                
+            } while (ret == NRF_SUCCESS);
+            break;
+        }
+        default:
+            break;
+    }
+}
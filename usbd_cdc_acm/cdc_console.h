@@ -0,0 +1,38 @@
+/**@file
+ * @defgroup cdc_console CDC ACM echo console
+ * @{
+ * @ingroup usbd_cdc_acm_example
+ * @brief Echo console on a CDC ACM port, driven by the CDC ACM user events
+ *
+ * Only uses app_usbd_cdc_acm_read/write and nrf_gpio, so it also builds on the host against
+ * common/host (see common/host/Makefile).
+ */
+#ifndef CDC_CONSOLE_H__
+#define CDC_CONSOLE_H__
+
+#include "app_usbd_cdc_acm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LED_USB_RESUME      (LED2_R)
+#define LED_CDC_ACM_OPEN    (LED2_B)
+#define LED_CDC_ACM_RX      (LED2_G)
+#define LED_CDC_ACM_TX      (LED1_G)
+
+/**@brief Handle a CDC ACM user event, in thread mode
+ *
+ * @param[in] p_cdc_acm CDC ACM instance
+ * @param[in] event     Event received by the CDC ACM user event handler
+ */
+void cdc_console_event_handle(app_usbd_cdc_acm_t const * p_cdc_acm,
+                              app_usbd_cdc_acm_user_event_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CDC_CONSOLE_H__
+
+/** @} */
@@ -46,6 +46,19 @@
 #ifdef USE_APP_CONFIG
 #include "app_config.h"
 #endif
+// <h> Application
+
+//==========================================================
+// <q> USBD_LATENCY_ENABLED  - usbd_latency - USB event queue latency measurement
+ 
+
+#ifndef USBD_LATENCY_ENABLED
+#define USBD_LATENCY_ENABLED 1
+#endif
+
+// </h>
+//==========================================================
+
 // <h> nRF_Drivers 
 
 //==========================================================
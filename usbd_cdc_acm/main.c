@@ -29,18 +29,12 @@
 
 #include "bsp.h"
 
-#define LED_USB_RESUME      (LED2_R)
-#define LED_CDC_ACM_OPEN    (LED2_B)
-#define LED_CDC_ACM_RX      (LED2_G)
-#define LED_CDC_ACM_TX      (LED1_G)
-
-#define CONSOLE_NAME "\r\n\033[0;32musbd_cdc_acm:~$\033[0m "
+#include "cdc_console.h"
+#include "usbd_latency.h"
 
 static void cdc_acm_user_ev_handler(app_usbd_class_inst_t const * p_inst,
                                     app_usbd_cdc_acm_user_event_t event);
 
-static void handle_cdc_event(void);
-
 
 /**
  * @brief CDC_ACM class instance
@@ -56,19 +50,9 @@ APP_USBD_CDC_ACM_GLOBAL_DEF(
     APP_USBD_CDC_COMM_PROTOCOL_AT_V250       // CDC protocol (see app_usbd_cdc_comm_protocol_t)
 );
 
-#define READ_SIZE 1
-
-static char g_rx_buffer[READ_SIZE];
-static char g_tx_buffer[NRFX_USBD_EPSIZE];
 static bool g_cdc_event_received = false;
 static app_usbd_cdc_acm_user_event_t g_cdc_event = 0;
 
-static void print_console_name(void)
-{
-    size_t size = sprintf(g_tx_buffer, CONSOLE_NAME);
-    app_usbd_cdc_acm_write(&m_app_cdc_acm, g_tx_buffer, size);
-}
-
 /**
  * @brief User defined CDC ACM event handler
  */
@@ -79,53 +63,6 @@ static void cdc_acm_user_ev_handler(app_usbd_class_inst_t const * p_inst,
     g_cdc_event          = event;
 }
 
-static void handle_cdc_event(void)
-{
-    g_cdc_event_received = false;
-    switch (g_cdc_event)
-    {
-        case APP_USBD_CDC_ACM_USER_EVT_PORT_OPEN:
-        {
-            nrf_gpio_pin_clear(LED_CDC_ACM_OPEN); // Turn ON
-
-            /*Setup first transfer*/
-            app_usbd_cdc_acm_read(&m_app_cdc_acm, g_rx_buffer, READ_SIZE);
-            size_t size = sprintf(g_tx_buffer, "USB Connected!\r\n\033[0;32musbd_cdc_acm:~$\033[0m ");
-            app_usbd_cdc_acm_write(&m_app_cdc_acm, g_tx_buffer, size);
-            break;
-        }
-        case APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE:
-            nrf_gpio_pin_set(LED_CDC_ACM_OPEN); // Turn OFF
-            break;
-        case APP_USBD_CDC_ACM_USER_EVT_TX_DONE:
-            nrf_gpio_pin_toggle(LED_CDC_ACM_TX);
-            break;
-        case APP_USBD_CDC_ACM_USER_EVT_RX_DONE:
-        {
-            nrf_gpio_pin_toggle(LED_CDC_ACM_RX);
-            ret_code_t ret = NRF_SUCCESS;
-            do
-            {
-                /* Fetch data until internal buffer is empty */
-                ret = app_usbd_cdc_acm_read(&m_app_cdc_acm, g_rx_buffer, READ_SIZE);
-                if(g_rx_buffer[0] == 0x0d) // New line received
-                {
-                    print_console_name();
-                }
-                else
-                {
-                    app_usbd_cdc_acm_write(&m_app_cdc_acm, g_rx_buffer, READ_SIZE);
-                }
-                
-                
-            } while (ret == NRF_SUCCESS);
-            break;
-        }
-        default:
-            break;
-    }
-}
-
 /**
  * @brief User defined USBD event handler
  */
@@ -178,6 +115,10 @@ int main(void)
 {
     ret_code_t ret = NRF_SUCCESS;
     static const app_usbd_config_t usbd_config = {
+#if USBD_LATENCY_ENABLED
+        .ev_isr_handler = usbd_latency_isr_handler,
+        .ev_handler     = usbd_latency_ev_handler,
+#endif
         .ev_state_proc = usbd_user_ev_handler
     };
 
@@ -190,6 +131,10 @@ int main(void)
 
     init_board();
 
+#if USBD_LATENCY_ENABLED
+    usbd_latency_init();
+#endif
+
     app_usbd_serial_num_generate();
 
     ret = app_usbd_init(&usbd_config);
@@ -205,10 +150,14 @@ int main(void)
     while (true)
     {
         while (app_usbd_event_queue_process()) { }/* Nothing to do */
+#if USBD_LATENCY_ENABLED
+        usbd_latency_queue_empty();
+#endif
 
         if(g_cdc_event_received)
         {
-            handle_cdc_event();
+            g_cdc_event_received = false;
+            cdc_console_event_handle(&m_app_cdc_acm, g_cdc_event);
         }
     }
 }
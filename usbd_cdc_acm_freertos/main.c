@@ -0,0 +1,350 @@
+/**@file
+ * @defgroup usbd_cdc_acm_freertos_example main.c
+ * @{
+ * @ingroup usbd_cdc_acm_freertos_example
+ * @brief USBD CDC ACM example on FreeRTOS
+ *
+ * Same echo console as usbd_cdc_acm, with the work of its main loop split into two tasks:
+ *
+ * - USB task, highest priority: woken by the USB interrupt for every event queued, processes the
+ *   app_usbd event queue and passes the CDC ACM user events on to the console task.
+ * - console task: handles the CDC ACM user events with cdc_console.c.
+ *
+ * app_usbd is not reentrant. A mutex is held by the USB task while it processes events and by
+ * the console task while it handles one event, which reads and writes the port. Whatever else
+ * the console task does in between no longer delays the USB events; priority inheritance bounds
+ * the wait of the USB task to the handling of one console event.
+ *
+ * The time USB events wait in the queue is measured by usbd_latency in both variants, compare
+ * the bench_usbd_latency_ variables (apps/build/profile_bench.py --run).
+ *
+ * The mutex is a traced_mutex: the waits of both tasks for it are logged over RTT every
+ * TRACED_MUTEX_REPORT_INTERVAL_MS by a report task, the lowest priority one.
+ *
+ * Log entries are processed by a logger task, resumed from the idle hook once per wakeup, so
+ * neither the USB task nor the console task ever waits for RTT.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/* FreeRTOS kernel dependencies */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+#include "nrf.h"
+#include "nrf_drv_usbd.h"
+#include "nrf_drv_clock.h"
+#include "nrf_gpio.h"
+#include "pca10059.h"
+#include "nrf_drv_power.h"
+
+#include "app_error.h"
+#include "app_util.h"
+#include "app_usbd_core.h"
+#include "app_usbd.h"
+#include "app_usbd_string_desc.h"
+#include "app_usbd_cdc_acm.h"
+#include "app_usbd_serial_num.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+#include "nrf_log_default_backends.h"
+
+#include "cdc_console.h"
+#include "traced_mutex.h"
+#include "usbd_latency.h"
+
+#define USBD_TASK_PRIORITY      2       /** Above the console task */
+#define CONSOLE_TASK_PRIORITY   1
+#define REPORT_TASK_PRIORITY    1
+#define LOGGER_TASK_PRIORITY    1
+#define USBD_TASK_STACK         256     /** USB task stack size in words */
+#define CONSOLE_TASK_STACK      256     /** Console task stack size in words */
+#define REPORT_TASK_STACK       256     /** Report task stack size in words, report formatting */
+#define LOGGER_TASK_STACK       256     /** Logger task stack size in words, log processing */
+#define CDC_EVENT_COUNT         8       /** CDC ACM user events queued for the console at most */
+
+static void cdc_acm_user_ev_handler(app_usbd_class_inst_t const * p_inst,
+                                    app_usbd_cdc_acm_user_event_t event);
+
+
+/**
+ * @brief CDC_ACM class instance
+ * */
+APP_USBD_CDC_ACM_GLOBAL_DEF(
+    m_app_cdc_acm,                           // USBD_CDC_ACM instance name
+    cdc_acm_user_ev_handler,                 // User event handler
+    0,                                       // Interface number of cdc_acm control
+    1,                                       // Interface number of cdc_acm DATA
+    NRFX_USBD_EPIN2,                         // COMM subclass IN endpoint
+    NRFX_USBD_EPIN1,                         // DATA subclass IN endpoint
+    NRFX_USBD_EPOUT1,                        // DATA subclass OUT endpoint
+    APP_USBD_CDC_COMM_PROTOCOL_AT_V250       // CDC protocol (see app_usbd_cdc_comm_protocol_t)
+);
+
+/* Memory of the tasks, the console event queue and the app_usbd mutex, handed to the
+   x*CreateStatic() and traced_mutex_init() calls of main(). */
+static StaticTask_t      m_usbd_task_tcb;
+static StackType_t       m_usbd_task_stack[USBD_TASK_STACK];
+static TaskHandle_t      m_usbd_task;
+static StaticTask_t      m_console_task_tcb;
+static StackType_t       m_console_task_stack[CONSOLE_TASK_STACK];
+static StaticQueue_t     m_cdc_events_buf;
+static uint8_t           m_cdc_events_storage[CDC_EVENT_COUNT * sizeof(app_usbd_cdc_acm_user_event_t)];
+static QueueHandle_t     m_cdc_events;          /** CDC ACM user events to the console task */
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+static StaticTask_t      m_logger_task_tcb;
+static StackType_t       m_logger_task_stack[LOGGER_TASK_STACK];
+static TaskHandle_t      m_logger_task;
+#endif
+#if TRACED_MUTEX_ENABLED
+static StaticTask_t      m_report_task_tcb;
+static StackType_t       m_report_task_stack[REPORT_TASK_STACK];
+TRACED_MUTEX_DEF(m_usbd_mutex);                 /** Held while calling into app_usbd */
+#else
+static StaticSemaphore_t m_usbd_mutex_buf;
+static SemaphoreHandle_t m_usbd_mutex;          /** Held while calling into app_usbd */
+#endif
+
+static void usbd_lock(void)
+{
+#if TRACED_MUTEX_ENABLED
+    (void)traced_mutex_take(&m_usbd_mutex, portMAX_DELAY);
+#else
+    (void)xSemaphoreTake(m_usbd_mutex, portMAX_DELAY);
+#endif
+}
+
+static void usbd_unlock(void)
+{
+#if TRACED_MUTEX_ENABLED
+    traced_mutex_give(&m_usbd_mutex);
+#else
+    (void)xSemaphoreGive(m_usbd_mutex);
+#endif
+}
+
+/**
+ * @brief User defined CDC ACM event handler, in the USB task
+ */
+static void cdc_acm_user_ev_handler(app_usbd_class_inst_t const * p_inst,
+                                    app_usbd_cdc_acm_user_event_t event)
+{
+    /* Queue full: the console is far behind, drop the event rather than blocking USB. */
+    (void)xQueueSend(m_cdc_events, &event, 0);
+}
+
+/**
+ * @brief User defined USBD event handler, in the USB task
+ */
+static void usbd_user_ev_handler(app_usbd_event_type_t event)
+{
+    switch (event)
+    {
+        case APP_USBD_EVT_DRV_SUSPEND:
+            nrf_gpio_pin_set(LED_USB_RESUME); // Turn OFF
+            break;
+        case APP_USBD_EVT_DRV_RESUME:
+            nrf_gpio_pin_clear(LED_USB_RESUME); // Turn ON
+            break;
+        case APP_USBD_EVT_STARTED:
+            break;
+        case APP_USBD_EVT_STOPPED:
+            app_usbd_disable();
+            // Turn off all LEDs
+            nrf_gpio_pin_set(LED_USB_RESUME  );
+            nrf_gpio_pin_set(LED_CDC_ACM_OPEN);
+            nrf_gpio_pin_set(LED_CDC_ACM_RX  );
+            nrf_gpio_pin_set(LED_CDC_ACM_TX  );
+            break;
+        case APP_USBD_EVT_POWER_DETECTED:
+            if (!nrf_drv_usbd_is_enabled())
+            {
+                app_usbd_enable();
+            }
+            break;
+        case APP_USBD_EVT_POWER_REMOVED:
+            app_usbd_stop();
+            break;
+        case APP_USBD_EVT_POWER_READY:
+            app_usbd_start();
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Called by app_usbd for every event queued, in the USB or POWER interrupt
+ */
+static void usbd_ev_isr_handler(app_usbd_internal_evt_t const * const p_event, bool queued)
+{
+    BaseType_t woken = pdFALSE;
+
+#if USBD_LATENCY_ENABLED
+    usbd_latency_isr_handler(p_event, queued);
+#endif
+
+    vTaskNotifyGiveFromISR(m_usbd_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void usbd_task(void * pvParameter)
+{
+    while (true)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        usbd_lock();
+        while (app_usbd_event_queue_process()) { }
+#if USBD_LATENCY_ENABLED
+        usbd_latency_queue_empty();
+#endif
+        usbd_unlock();
+    }
+}
+
+static void console_task(void * pvParameter)
+{
+    while (true)
+    {
+        app_usbd_cdc_acm_user_event_t event;
+
+        (void)xQueueReceive(m_cdc_events, &event, portMAX_DELAY);
+
+        usbd_lock();
+        cdc_console_event_handle(&m_app_cdc_acm, event);
+        usbd_unlock();
+    }
+}
+
+#if TRACED_MUTEX_ENABLED
+static void report_print(void * p_ctx, char const * p_line)
+{
+    UNUSED_PARAMETER(p_ctx);
+
+    /* The line is on the stack of the caller, the entry keeps a copy. */
+    NRF_LOG_INFO("%s", NRF_LOG_PUSH((char *)p_line));
+}
+
+static void report_task(void * pvParameter)
+{
+    TickType_t wake = xTaskGetTickCount();
+
+    while (true)
+    {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(TRACED_MUTEX_REPORT_INTERVAL_MS));
+        traced_mutex_report(report_print, NULL);
+    }
+}
+#endif
+
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+static void logger_task(void * pvParameter)
+{
+    while (true)
+    {
+        while (NRF_LOG_PROCESS()) { }
+        vTaskSuspend(NULL);
+    }
+}
+#endif
+
+/**@brief Idle hook, resumes the logger before the idle task sleeps. */
+void vApplicationIdleHook(void)
+{
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+    vTaskResume(m_logger_task);
+#endif
+}
+
+static void init_board(void)
+{
+    nrf_gpio_cfg_output(LED_USB_RESUME);   nrf_gpio_pin_write(LED_USB_RESUME, 1);
+    nrf_gpio_cfg_output(LED_CDC_ACM_OPEN); nrf_gpio_pin_write(LED_CDC_ACM_OPEN, 1);
+    nrf_gpio_cfg_output(LED_CDC_ACM_RX);   nrf_gpio_pin_write(LED_CDC_ACM_RX, 1);
+    nrf_gpio_cfg_output(LED_CDC_ACM_TX);   nrf_gpio_pin_write(LED_CDC_ACM_TX, 1);
+}
+
+int main(void)
+{
+    ret_code_t ret = NRF_SUCCESS;
+    static const app_usbd_config_t usbd_config = {
+        .ev_isr_handler = usbd_ev_isr_handler,
+#if USBD_LATENCY_ENABLED
+        .ev_handler     = usbd_latency_ev_handler,
+#endif
+        .ev_state_proc  = usbd_user_ev_handler
+    };
+
+    ret = nrf_drv_clock_init();
+    APP_ERROR_CHECK(ret);
+
+    init_board();
+
+    /* Logger over RTT, for the lock reports */
+    ret = NRF_LOG_INIT(NULL);
+    APP_ERROR_CHECK(ret);
+    NRF_LOG_DEFAULT_BACKENDS_INIT();
+#if NRF_LOG_ENABLED && NRF_LOG_DEFERRED
+    m_logger_task = xTaskCreateStatic(logger_task, "LOG", LOGGER_TASK_STACK, NULL,
+                                      LOGGER_TASK_PRIORITY, m_logger_task_stack,
+                                      &m_logger_task_tcb);
+#endif
+
+#if USBD_LATENCY_ENABLED
+    usbd_latency_init();
+#endif
+
+    /* The tasks exist before the first USB event can be queued */
+#if TRACED_MUTEX_ENABLED
+    traced_mutex_init(&m_usbd_mutex, "usbd");
+    (void)xTaskCreateStatic(report_task, "LOCK", REPORT_TASK_STACK, NULL,
+                            REPORT_TASK_PRIORITY, m_report_task_stack, &m_report_task_tcb);
+#else
+    m_usbd_mutex = xSemaphoreCreateMutexStatic(&m_usbd_mutex_buf);
+#endif
+    m_cdc_events = xQueueCreateStatic(CDC_EVENT_COUNT, sizeof(app_usbd_cdc_acm_user_event_t),
+                                      m_cdc_events_storage, &m_cdc_events_buf);
+    m_usbd_task  = xTaskCreateStatic(usbd_task, "USBD", USBD_TASK_STACK, NULL,
+                                     USBD_TASK_PRIORITY, m_usbd_task_stack, &m_usbd_task_tcb);
+    (void)xTaskCreateStatic(console_task, "CONS", CONSOLE_TASK_STACK, NULL,
+                            CONSOLE_TASK_PRIORITY, m_console_task_stack, &m_console_task_tcb);
+
+    app_usbd_serial_num_generate();
+
+    ret = app_usbd_init(&usbd_config);
+    APP_ERROR_CHECK(ret);
+
+    app_usbd_class_inst_t const * class_cdc_acm = app_usbd_cdc_acm_class_inst_get(&m_app_cdc_acm);
+    ret = app_usbd_class_append(class_cdc_acm);
+    APP_ERROR_CHECK(ret);
+
+    ret = app_usbd_power_events_enable();
+    APP_ERROR_CHECK(ret);
+
+    /* Starts LFCLK for the RTC1 tick, the FreeRTOS port requests it */
+    vTaskStartScheduler();
+
+    /* Only reached if the idle task could not be created */
+    APP_ERROR_CHECK(NRF_ERROR_NO_MEM);
+}
+
+/**@brief Memory of the idle task, required with configSUPPORT_STATIC_ALLOCATION. */
+void vApplicationGetIdleTaskMemory(StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                   StackType_t ** ppxIdleTaskStackBuffer,
+                                   uint32_t *     pulIdleTaskStackSize)
+{
+    static StaticTask_t tcb;
+    static StackType_t  stack[configMINIMAL_STACK_SIZE];
+
+    *ppxIdleTaskTCBBuffer   = &tcb;
+    *ppxIdleTaskStackBuffer = stack;
+    *pulIdleTaskStackSize   = configMINIMAL_STACK_SIZE;
+}
+
+/** @} */